@@ -0,0 +1,225 @@
+#!/usr/bin/env python3
+"""Measures the cost of compiling a hash-map as the number of its elements grows.
+
+Every measurement generates a translation unit with a single static constexpr hash-map of N elements,
+static assertions that look up its last key and a missing one (so the whole constructor and lookups
+are evaluated by the compiler) and a function looking up a runtime key (so the map and the lookup
+are left in the object file). Recorded are compile time, peak memory of the compiler, sizes of
+the .text, .rodata and .data.rel.ro sections of the object file and optionally (--limits) the smallest
+constexpr depth and number of constexpr operations (steps on the clang) the compiler needs.
+
+Results might be saved as JSON (--json) and compared with the previously saved ones (--baseline),
+in which case the script fails if anything grew more than the tolerance allows.
+
+Usage: benchmark/compile_time.py [--compiler g++] [--sizes 16,256,4096] [--keys const-char,string-view,int]
+                                 [--backend linear] [--limits] [--json results.json] [--baseline results.json]
+"""
+
+import argparse
+import json
+import os
+import pathlib
+import subprocess
+import sys
+import tempfile
+import time
+
+ROOT = pathlib.Path(__file__).resolve().parent.parent
+
+# key type, literal of the i-th key and of a key that isn't in the map
+KEYS = {
+    "const-char": ("const char*", lambda i: f'"key{i}"', '"missing"'),
+    "string-view": ("std::string_view", lambda i: f'"key{i}"', '"missing"'),
+    "int": ("int", lambda i: str(i * 3), "-1"),
+}
+
+# measured quantities, those that are compared with the baseline
+METRICS = ("seconds", "memory", "text", "rodata", "relro", "depth", "operations")
+# growth of the noisy metrics has to exceed these too to be reported (seconds and MiB)
+SLACK = {"seconds": 0.5, "memory": 16}
+
+
+def generate(size, keys, backend):
+    key_type, key, missing = KEYS[keys]
+    entries = ",\n".join(f"    std::make_pair({key(i)}, {i})" for i in range(size))
+
+    return f"""#include <string_view>
+
+#include <constexpr_hash_map/constexpr_hash_map.hpp>
+
+static constexpr burda::ct::hash_map<{size}, {key_type}, int, burda::ct::hash<{key_type}>, burda::ct::equal_to<{key_type}>, burda::ct::backend::{backend}> map
+{{
+{entries}
+}};
+
+static_assert(map[{key(size - 1)}] == {size - 1});
+static_assert(!map.contains({missing}));
+
+int lookup({key_type} key)
+{{
+    return map.contains(key) ? map[key] : -1;
+}}
+"""
+
+
+def compile_source(compiler, source, flags, output=os.devnull):
+    """Compiles given file, returns (success, seconds, peak resident memory in MiB)."""
+    command = [compiler, str(source), "-I", str(ROOT / "include"), "-std=c++17", "-O2", "-c",
+               "-o", str(output)] + flags
+    # diagnostics go to a file, a pipe could fill up and block the compiler before it's waited for
+    with tempfile.TemporaryFile() as errors:
+        start = time.perf_counter()
+        process = subprocess.Popen(command, stdout=subprocess.DEVNULL, stderr=errors)
+        _, status, usage = os.wait4(process.pid, 0)
+        elapsed = time.perf_counter() - start
+        process.returncode = os.waitstatus_to_exitcode(status)
+        errors.seek(0)
+        error = errors.read().decode(errors="replace")
+
+    if process.returncode != 0 and output != os.devnull:
+        sys.stderr.write(error[:2000])
+
+    # ru_maxrss is in KiB on Linux
+    return process.returncode == 0, elapsed, usage.ru_maxrss / 1024
+
+
+def section_sizes(object_file):
+    """Sizes of the .text, .rodata and .data.rel.ro sections (including their .name.* variants) in bytes."""
+    sizes = {"text": 0, "rodata": 0, "relro": 0}
+    prefixes = {"text": ".text", "rodata": ".rodata", "relro": ".data.rel.ro"}
+    listing = subprocess.run(["size", "-A", str(object_file)], capture_output=True, text=True, check=True).stdout
+
+    for line in listing.splitlines():
+        fields = line.split()
+
+        if len(fields) < 2 or not fields[1].isdigit():
+            continue
+
+        for metric, prefix in prefixes.items():
+            if fields[0] == prefix or fields[0].startswith(prefix + "."):
+                sizes[metric] += int(fields[1])
+
+    return sizes
+
+
+def smallest_limit(compiler, source, flags, flag, highest, precision):
+    """Smallest value of the limit given by the flag (up to the highest), with which the source still compiles.
+
+    Limits are bisected until the bounds are within the precision (relative), None if even the highest isn't enough.
+    """
+    def compiles(limit):
+        # the bisected limit comes last, so that it overrides the one among the flags
+        return compile_source(compiler, source, flags + ["-fsyntax-only", f"{flag}={limit}"])[0]
+
+    if not compiles(highest):
+        return None
+
+    lowest = 0
+
+    while highest - lowest > max(1, int(lowest * precision)):
+        middle = (lowest + highest) // 2
+
+        if compiles(middle):
+            highest = middle
+        else:
+            lowest = middle
+
+    return highest
+
+
+def measure(arguments, directory, keys, size):
+    source = pathlib.Path(directory) / f"map_{keys}_{size}.cpp"
+    source.write_text(generate(size, keys, arguments.backend))
+    object_file = source.with_suffix(".o")
+    success, seconds, memory = compile_source(arguments.compiler, source, arguments.flags.split(), object_file)
+    result = {"keys": keys, "size": size, "success": success, "seconds": seconds, "memory": memory}
+
+    if not success:
+        return result
+
+    result.update(section_sizes(object_file))
+
+    if arguments.limits:
+        operations_flag = "-fconstexpr-steps" if "clang" in arguments.compiler else "-fconstexpr-ops-limit"
+        flags = arguments.flags.split()
+        result["depth"] = smallest_limit(arguments.compiler, source, flags, "-fconstexpr-depth", 4096, 0)
+        result["operations"] = smallest_limit(arguments.compiler, source, flags, operations_flag, 1 << 31, 0.05)
+
+    return result
+
+
+def regressions(results, baseline, tolerance):
+    """Descriptions of metrics that grew over the tolerance compared to the baseline (and of measurements that started to fail)."""
+    previous = {(entry["keys"], entry["size"]): entry for entry in baseline}
+    found = []
+
+    for entry in results:
+        old = previous.get((entry["keys"], entry["size"]))
+
+        if old is None:
+            continue
+
+        if old["success"] and not entry["success"]:
+            found.append(f"{entry['keys']} N={entry['size']}: doesn't compile anymore")
+
+        for metric in METRICS:
+            if entry.get(metric) is not None and old.get(metric):
+                if entry[metric] > old[metric] * tolerance and entry[metric] - old[metric] > SLACK.get(metric, 0):
+                    found.append(f"{entry['keys']} N={entry['size']}: {metric} {old[metric]:.10g} -> {entry[metric]:.10g}")
+
+    return found
+
+
+def cell(value, width):
+    return f"{'-':>{width}}" if value is None else f"{value:>{width}}"
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--compiler", default="g++")
+    parser.add_argument("--sizes", default="16,64,256,1024,4096,16384", help="up to 65536 (might need to raise the compiler's limits)")
+    parser.add_argument("--keys", default=",".join(KEYS), help="comma-separated types of keys: " + ", ".join(KEYS))
+    parser.add_argument("--backend", default="linear")
+    parser.add_argument("--flags", default="", help="additional compiler flags")
+    parser.add_argument("--limits", action="store_true", help="bisect the smallest constexpr depth and number of operations (slow)")
+    parser.add_argument("--json", help="file to which results are written")
+    parser.add_argument("--baseline", help="file with results written previously by the --json, to be compared with")
+    parser.add_argument("--tolerance", type=float, default=1.25, help="allowed ratio of growth compared to the baseline")
+    arguments = parser.parse_args()
+
+    print(f"{'keys':>12} {'N':>8} {'seconds':>10} {'peak MiB':>10} {'.text':>10} {'.rodata':>10} {'.rel.ro':>10} {'depth':>8} {'ops':>12}")
+
+    results = []
+
+    with tempfile.TemporaryDirectory() as directory:
+        for keys in arguments.keys.split(","):
+            for size in (int(value) for value in arguments.sizes.split(",")):
+                result = measure(arguments, directory, keys, size)
+                results.append(result)
+                print(f"{keys:>12} {size:>8} {result['seconds']:>10.2f} {result['memory']:>10.1f} "
+                      f"{cell(result.get('text'), 10)} {cell(result.get('rodata'), 10)} {cell(result.get('relro'), 10)} "
+                      f"{cell(result.get('depth'), 8)} {cell(result.get('operations'), 12)}"
+                      + ("" if result["success"] else "  FAILED"), flush=True)
+
+                if not result["success"]:
+                    # bigger maps would fail as well
+                    break
+
+    if arguments.json:
+        pathlib.Path(arguments.json).write_text(json.dumps(results, indent=2) + "\n")
+
+    failed = any(not result["success"] for result in results)
+
+    if arguments.baseline:
+        found = regressions(results, json.loads(pathlib.Path(arguments.baseline).read_text()), arguments.tolerance)
+
+        for regression in found:
+            print(f"regression: {regression}", file=sys.stderr)
+
+        failed = failed or bool(found)
+
+    return 1 if failed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,76 @@
+// Measures runtime lookups of the backend::linear with 32-bit integral keys: vectorized scan of keys (used with the burda::ct::equal_to)
+// against the scalar loop (used with any other KeyEqual, std::equal_to here).
+//
+// Usage: g++ -std=c++17 -O2 [-mavx2] -I include benchmark/linear_scan.cpp -o linear_scan && ./linear_scan
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <vector>
+
+#include <constexpr_hash_map/constexpr_hash_map.hpp>
+
+namespace
+{
+constexpr std::size_t lookups = 1U << 24U;
+
+template <std::size_t N, typename KeyEqual>
+constexpr auto map = burda::ct::make_hash_map<burda::ct::hash_map<N, std::uint32_t, std::uint32_t, burda::ct::hash<std::uint32_t>, KeyEqual, burda::ct::backend::linear>>(
+    [](std::size_t i) { return std::make_pair(static_cast<std::uint32_t>(i * 7 + 3), static_cast<std::uint32_t>(i)); });
+
+// every other query misses, hits are spread over the whole map
+std::vector<std::uint32_t> queries(std::size_t size)
+{
+    std::vector<std::uint32_t> result(lookups);
+    std::uint32_t state = 1;
+
+    for (auto& query : result)
+    {
+        state = state * 1664525U + 1013904223U;
+        const auto i = (state >> 8U) % size;
+        query = static_cast<std::uint32_t>((state & 1U) != 0 ? i * 7 + 3 : i * 7 + 4);
+    }
+
+    return result;
+}
+
+template <std::size_t N, typename KeyEqual>
+double nanoseconds_per_lookup(const std::vector<std::uint32_t>& keys, std::size_t& found)
+{
+    const auto start = std::chrono::steady_clock::now();
+
+    for (const auto key : keys)
+    {
+        found += map<N, KeyEqual>.contains(key) ? 1 : 0;
+    }
+
+    const std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+
+    return elapsed.count() / static_cast<double>(keys.size());
+}
+
+template <std::size_t N>
+void measure()
+{
+    const auto keys = queries(N);
+    std::size_t found = 0;
+    const auto scalar = nanoseconds_per_lookup<N, std::equal_to<std::uint32_t>>(keys, found);
+    const auto vectorized = nanoseconds_per_lookup<N, burda::ct::equal_to<std::uint32_t>>(keys, found);
+
+    std::printf("%8zu %12.2f %12.2f %10.2fx %12zu\n", N, scalar, vectorized, scalar / vectorized, found);
+}
+}  // namespace
+
+int main()
+{
+    std::printf("%8s %12s %12s %11s %12s\n", "N", "scalar ns", "vector ns", "speedup", "found");
+
+    measure<4>();
+    measure<8>();
+    measure<16>();
+    measure<32>();
+    measure<64>();
+
+    return 0;
+}
@@ -0,0 +1,316 @@
+// Measures runtime lookups (find, contains, at and operator[]) of the hash-map backends for string and integral keys,
+// several sizes and ratios of hits, compared to the std::unordered_map and to a switch over hashes of keys
+// (a decision tree over sorted constants, which is how compilers lower a sparse switch).
+// Queries are copied to the heap and shuffled before measuring, so the compiler can't fold any of the lookups.
+//
+// Usage: g++ -std=c++17 -O2 [-mavx2] -I include benchmark/runtime.cpp -o runtime && ./runtime [lookups per measurement]
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <constexpr_hash_map/constexpr_hash_map.hpp>
+
+namespace
+{
+using namespace burda::ct;
+
+constexpr std::size_t alphabet = 26;
+
+/// characters of N unique keys of given length: pseudo-random letters, the last four encode the position of the key
+template <std::size_t N, std::size_t Length>
+struct string_keys
+{
+    static_assert(Length >= 4, "Four characters are needed to make keys unique");
+
+    constexpr string_keys() noexcept
+    {
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            for (std::size_t j = 0; j < Length; ++j)
+            {
+                characters[i][j] = static_cast<char>('a' + detail::mix(i * Length + j) % alphabet);
+            }
+
+            for (std::size_t j = 0, position = i; j < 4; ++j, position /= alphabet)
+            {
+                characters[i][Length - 1 - j] = static_cast<char>('a' + position % alphabet);
+            }
+        }
+    }
+
+    [[nodiscard]] constexpr std::string_view operator[](std::size_t i) const noexcept
+    {
+        return {characters[i].data(), Length};
+    }
+
+    std::array<std::array<char, Length>, N> characters{};
+};
+
+template <std::size_t N, std::size_t Length>
+constexpr string_keys<N, Length> strings{};
+
+/// keys of the integral maps, narrow enough for the backend::dense to use its table
+[[nodiscard]] constexpr std::uint32_t integer(std::size_t i) noexcept
+{
+    return static_cast<std::uint32_t>(i * 3);
+}
+
+template <typename Backend, std::size_t N, std::size_t Length>
+constexpr auto string_map = make_hash_map<hash_map<N, std::string_view, int, hash<std::string_view>, equal_to<std::string_view>, Backend>>(
+    [](std::size_t i) { return std::make_pair(strings<N, Length>[i], static_cast<int>(i)); });
+
+template <typename Backend, std::size_t N>
+constexpr auto integral_map = make_hash_map<hash_map<N, std::uint32_t, int, hash<std::uint32_t>, equal_to<std::uint32_t>, Backend>>(
+    [](std::size_t i) { return std::make_pair(integer(i), static_cast<int>(i)); });
+
+/// sorted hashes of the keys together with positions of the keys they belong to
+template <std::size_t N, typename Key>
+struct switch_cases
+{
+    template <typename Keys>
+    constexpr switch_cases(const Keys& keys) noexcept
+    {
+        std::array<std::uint64_t, N> unsorted{};
+
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            unsorted[i] = hash<Key>{}(keys(i));
+            positions[i] = i;
+        }
+
+        detail::heap_sort(positions, [&unsorted](std::size_t lhs, std::size_t rhs) { return unsorted[lhs] < unsorted[rhs]; });
+
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            hashes[i] = unsorted[positions[i]];
+        }
+    }
+
+    std::array<std::uint64_t, N> hashes{};
+    std::array<std::size_t, N> positions{};
+};
+
+template <std::size_t N, std::size_t Length>
+constexpr switch_cases<N, std::string_view> string_cases{[](std::size_t i) { return strings<N, Length>[i]; }};
+
+template <std::size_t N>
+constexpr switch_cases<N, std::uint32_t> integral_cases{[](std::size_t i) { return integer(i); }};
+
+/// decision tree over the sorted hashes, every comparison is with a constant as in the code generated for a switch
+template <const auto& Cases, std::size_t First, std::size_t Last>
+[[nodiscard]] std::size_t switch_position(std::uint64_t hash) noexcept
+{
+    if constexpr (Last - First == 1)
+    {
+        return hash == Cases.hashes[First] ? Cases.positions[First] : Cases.hashes.size();
+    }
+    else
+    {
+        constexpr auto middle = First + (Last - First) / 2;
+
+        return hash < Cases.hashes[middle] ? switch_position<Cases, First, middle>(hash) : switch_position<Cases, middle, Last>(hash);
+    }
+}
+
+/// lookup of the given queries measured by the clock
+template <typename Query, typename Lookup>
+[[nodiscard]] double nanoseconds_per_lookup(const std::vector<Query>& queries, const Lookup& lookup, std::int64_t& sink)
+{
+    const auto start = std::chrono::steady_clock::now();
+
+    for (const auto& query : queries)
+    {
+        sink += lookup(query);
+    }
+
+    const std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+
+    return elapsed.count() / static_cast<double>(queries.size());
+}
+
+struct result
+{
+    const char* container;
+    double find;
+    double contains;
+    double at;
+    double subscript;
+};
+
+void print(const char* keys, std::size_t size, unsigned hits, const result& measured)
+{
+    const auto cell = [](double value) {
+        if (value < 0)
+        {
+            std::printf(" %10s", "-");
+        }
+        else
+        {
+            std::printf(" %10.2f", value);
+        }
+    };
+
+    std::printf("%-12s %6zu %5u%% %-22s", keys, size, hits, measured.container);
+    cell(measured.find);
+    cell(measured.contains);
+    cell(measured.at);
+    cell(measured.subscript);
+    std::printf("\n");
+}
+
+/// measures all the operations of the map, operator[] only if all the queries hit
+template <typename Map, typename Query>
+[[nodiscard]] result measure_map(const char* name, const Map& map, const std::vector<Query>& queries, bool all_hit, std::int64_t& sink)
+{
+    return {name,
+            nanoseconds_per_lookup(queries, [&map](const Query& key) { const auto it = map.find(key); return it != map.end() ? it->second : -1; }, sink),
+            nanoseconds_per_lookup(queries, [&map](const Query& key) { return map.contains(key) ? 1 : 0; }, sink),
+            nanoseconds_per_lookup(queries, [&map](const Query& key) { const auto [found, value] = map.at(key); return found ? value : -1; }, sink),
+            all_hit ? nanoseconds_per_lookup(queries, [&map](const Query& key) { return map[key]; }, sink) : -1};
+}
+
+/// measures the std::unordered_map with the same elements, at() is the find(), operator[] is the (throwing) at()
+template <typename Map, typename Query>
+[[nodiscard]] result measure_unordered_map(const Map& map, const std::vector<Query>& queries, bool all_hit, std::int64_t& sink)
+{
+    std::unordered_map<typename Map::key_type, int> unordered(map.begin(), map.end());
+
+    return {"std::unordered_map",
+            nanoseconds_per_lookup(queries, [&unordered](const Query& key) { const auto it = unordered.find(key); return it != unordered.end() ? it->second : -1; }, sink),
+            nanoseconds_per_lookup(queries, [&unordered](const Query& key) { return static_cast<int>(unordered.count(key)); }, sink),
+            -1,
+            all_hit ? nanoseconds_per_lookup(queries, [&unordered](const Query& key) { return unordered.at(key); }, sink) : -1};
+}
+
+/// measures the switch over hashes (position of the hash is verified by comparing keys, as the hash map does)
+template <const auto& Cases, typename Key, typename Keys, typename Query>
+[[nodiscard]] result measure_switch(const Keys& keys, const std::vector<Query>& queries, std::int64_t& sink)
+{
+    constexpr auto size = Cases.hashes.size();
+
+    return {"switch over hashes", nanoseconds_per_lookup(queries, [&keys](const Query& key) {
+                const auto position = switch_position<Cases, 0, size>(hash<Key>{}(key));
+
+                return position != size && keys(position) == key ? static_cast<int>(position) : -1;
+            }, sink), -1, -1, -1};
+}
+
+/// queries with given percentage of hits in random order, misses differ from the keys only in the last character
+[[nodiscard]] std::vector<std::uint32_t> integral_queries(std::size_t size, std::size_t lookups, unsigned hits, std::mt19937& random)
+{
+    std::vector<std::uint32_t> queries(lookups);
+    std::uniform_int_distribution<std::size_t> position(0, size - 1);
+    std::uniform_int_distribution<unsigned> percent(0, 99);
+
+    for (auto& query : queries)
+    {
+        query = integer(position(random)) + (percent(random) < hits ? 0 : 1);
+    }
+
+    return queries;
+}
+
+/// storage of the strings of queries, which are views to it
+struct string_queries
+{
+    std::vector<std::string> storage;
+    std::vector<std::string_view> views;
+};
+
+template <std::size_t N, std::size_t Length>
+[[nodiscard]] string_queries make_string_queries(std::size_t lookups, unsigned hits, std::mt19937& random)
+{
+    string_queries queries;
+    std::uniform_int_distribution<std::size_t> position(0, N - 1);
+    std::uniform_int_distribution<unsigned> percent(0, 99);
+
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        const auto key = strings<N, Length>[i];
+        queries.storage.emplace_back(key);
+        // upper-case letters aren't used in keys
+        queries.storage.emplace_back(key.substr(0, Length - 1)).push_back('A');
+    }
+
+    for (std::size_t i = 0; i < lookups; ++i)
+    {
+        queries.views.emplace_back(queries.storage[position(random) * 2 + (percent(random) < hits ? 0 : 1)]);
+    }
+
+    return queries;
+}
+
+template <std::size_t N, std::size_t Length>
+void measure_strings(std::size_t lookups, std::mt19937& random, std::int64_t& sink)
+{
+    const auto name = Length == 8 ? "string[8]" : "string[32]";
+    const auto keys = [](std::size_t i) { return strings<N, Length>[i]; };
+
+    for (const auto hits : {100U, 50U, 0U})
+    {
+        const auto queries = make_string_queries<N, Length>(lookups, hits, random);
+        const auto& views = queries.views;
+        const auto all_hit = hits == 100;
+
+        print(name, N, hits, measure_map("linear", string_map<backend::linear, N, Length>, views, all_hit, sink));
+        print(name, N, hits, measure_map("fingerprint", string_map<backend::fingerprint, N, Length>, views, all_hit, sink));
+        print(name, N, hits, measure_map("perfect_hash", string_map<backend::perfect_hash, N, Length>, views, all_hit, sink));
+        print(name, N, hits, measure_map("sorted", string_map<backend::sorted<>, N, Length>, views, all_hit, sink));
+        print(name, N, hits, measure_map("eytzinger", string_map<backend::eytzinger<>, N, Length>, views, all_hit, sink));
+        print(name, N, hits, measure_unordered_map(string_map<backend::linear, N, Length>, views, all_hit, sink));
+        print(name, N, hits, measure_switch<string_cases<N, Length>, std::string_view>(keys, views, sink));
+    }
+}
+
+template <std::size_t N>
+void measure_integers(std::size_t lookups, std::mt19937& random, std::int64_t& sink)
+{
+    for (const auto hits : {100U, 50U, 0U})
+    {
+        const auto queries = integral_queries(N, lookups, hits, random);
+        const auto all_hit = hits == 100;
+
+        // 32-bit keys of at most 64 elements are scanned with the SIMD instructions by the linear backend
+        print("uint32_t", N, hits, measure_map(N <= 64 ? "linear (SIMD)" : "linear", integral_map<backend::linear, N>, queries, all_hit, sink));
+        print("uint32_t", N, hits, measure_map("dense", integral_map<backend::dense, N>, queries, all_hit, sink));
+        print("uint32_t", N, hits, measure_map("perfect_hash", integral_map<backend::perfect_hash, N>, queries, all_hit, sink));
+        print("uint32_t", N, hits, measure_map("sorted", integral_map<backend::sorted<>, N>, queries, all_hit, sink));
+        print("uint32_t", N, hits, measure_map("eytzinger", integral_map<backend::eytzinger<>, N>, queries, all_hit, sink));
+        print("uint32_t", N, hits, measure_unordered_map(integral_map<backend::linear, N>, queries, all_hit, sink));
+        print("uint32_t", N, hits, measure_switch<integral_cases<N>, std::uint32_t>(integer, queries, sink));
+    }
+}
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    const std::size_t lookups = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1U << 18U;
+    std::mt19937 random{42};
+    std::int64_t sink = 0;
+
+    std::printf("%-12s %6s %6s %-22s %10s %10s %10s %10s   (ns per lookup)\n", "keys", "N", "hits", "container", "find", "contains", "at", "operator[]");
+
+    measure_integers<16>(lookups, random, sink);
+    measure_integers<128>(lookups, random, sink);
+    measure_integers<1024>(lookups, random, sink);
+    measure_strings<16, 8>(lookups, random, sink);
+    measure_strings<128, 8>(lookups, random, sink);
+    measure_strings<1024, 8>(lookups, random, sink);
+    measure_strings<16, 32>(lookups, random, sink);
+    measure_strings<128, 32>(lookups, random, sink);
+    measure_strings<1024, 32>(lookups, random, sink);
+
+    // printed, so that none of the lookups is optimized away
+    std::printf("checksum %lld\n", static_cast<long long>(sink));
+
+    return 0;
+}
@@ -3,20 +3,2433 @@
 
 #include <array>
 #include <cstddef>
+#include <cstdint>
 #include <iterator>
+#include <string_view>
+#include <type_traits>
 #include <utility>
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define CONSTEXPR_HASH_MAP_AVX2 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define CONSTEXPR_HASH_MAP_SSE2 1
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define CONSTEXPR_HASH_MAP_NEON 1
+#endif
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+#if defined(__cpp_lib_is_constant_evaluated)
+#define CONSTEXPR_HASH_MAP_IS_CONSTANT_EVALUATED() std::is_constant_evaluated()
+#elif defined(__clang__)
+#if __has_builtin(__builtin_is_constant_evaluated)
+#define CONSTEXPR_HASH_MAP_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#endif
+#elif (defined(__GNUC__) && __GNUC__ >= 9) || (defined(_MSC_VER) && _MSC_VER >= 1925)
+#define CONSTEXPR_HASH_MAP_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#endif
+
+#if defined(__cpp_nontype_template_args) && __cpp_nontype_template_args >= 201911L
+#define CONSTEXPR_HASH_MAP_CLASS_TEMPLATE_ARGUMENTS 1
+#endif
+
+// opt-in (C++20): maps are constructed (and their indices built) only at compile time, by consteval functions
+#if defined(CONSTEXPR_HASH_MAP_CONSTEVAL_BUILD) && defined(__cpp_consteval) && __cpp_consteval >= 201811L
+#define CONSTEXPR_HASH_MAP_BUILD consteval
+#else
+#define CONSTEXPR_HASH_MAP_BUILD constexpr
+#endif
+
+#if defined(__has_include)
+#if __has_include(<version>)
+#include <version>
+#endif
+#endif
+
+#if defined(__cpp_lib_span) && __cpp_lib_span >= 202002L
+#include <span>
+#define CONSTEXPR_HASH_MAP_SPAN 1
+#endif
+
 namespace burda::ct
 {
+/// @private implementation details, not part of the public interface
+namespace detail
+{
+/// @private offset basis of the 64-bit FNV-1a
+constexpr std::uint64_t fnv_offset_basis = 14695981039346656037ULL;
+/// @private prime of the 64-bit FNV-1a
+constexpr std::uint64_t fnv_prime = 1099511628211ULL;
+/// @private odd constant derived from the golden ratio, used to spread seeds and integral keys
+constexpr std::uint64_t golden_ratio = 0x9E3779B97F4A7C15ULL;
+
+/// @private finalizer of the splitmix64, diffuses all bits of the input
+[[nodiscard]] constexpr std::uint64_t mix(std::uint64_t value) noexcept
+{
+    constexpr std::uint64_t first_multiplier = 0xBF58476D1CE4E5B9ULL;
+    constexpr std::uint64_t second_multiplier = 0x94D049BB133111EBULL;
+    constexpr unsigned first_shift = 30;
+    constexpr unsigned second_shift = 27;
+    constexpr unsigned third_shift = 31;
+
+    value = (value ^ (value >> first_shift)) * first_multiplier;
+    value = (value ^ (value >> second_shift)) * second_multiplier;
+
+    return value ^ (value >> third_shift);
+}
+
+/// @private marks seeds of the backend::perfect_hash that directly contain the slot (used for buckets with a single key)
+constexpr std::uint32_t perfect_hash_direct_flag = 1U << 31U;
+
+/// @private bucket of a hash in the backend::perfect_hash of given size (also used by the hash_map_view over serialized images)
+[[nodiscard]] constexpr std::size_t perfect_hash_bucket(std::uint64_t hash, std::size_t size) noexcept
+{
+    return static_cast<std::size_t>(hash % size);
+}
+
+/// @private slot of a hash within its bucket using given seed, see the perfect_hash_bucket
+[[nodiscard]] constexpr std::size_t perfect_hash_displace(std::uint64_t hash, std::uint32_t seed, std::size_t size) noexcept
+{
+    return static_cast<std::size_t>(mix(hash ^ (seed * golden_ratio)) % size);
+}
+
+/// @private slot that the key with given hash occupies, given the seed of its bucket, see the perfect_hash_bucket
+[[nodiscard]] constexpr std::size_t perfect_hash_slot(std::uint64_t hash, std::uint32_t seed, std::size_t size) noexcept
+{
+    return (seed & perfect_hash_direct_flag) != 0 ? static_cast<std::size_t>(seed & ~perfect_hash_direct_flag) : perfect_hash_displace(hash, seed, size);
+}
+
+/// @private 64-bit FNV-1a of a sequence of characters
+[[nodiscard]] constexpr std::uint64_t fnv1a(std::string_view characters) noexcept
+{
+    std::uint64_t hash = fnv_offset_basis;
+
+    for (const char character : characters)
+    {
+        hash = (hash ^ static_cast<unsigned char>(character)) * fnv_prime;
+    }
+
+    return hash;
+}
+
+/// @private length of a null-terminated string; iterative in constexpr context, std::strlen at runtime
+[[nodiscard]] constexpr std::size_t length(const char* characters) noexcept
+{
+    return std::char_traits<char>::length(characters);
+}
+
+/// @private compares first "count" characters; iterative in constexpr context, std::memcmp at runtime
+[[nodiscard]] constexpr bool equal(const char* lhs, const char* rhs, std::size_t count) noexcept
+{
+    return std::char_traits<char>::compare(lhs, rhs, count) == 0;
+}
+
+/// @private converts ASCII upper-case letter to the lower-case, other characters are left intact
+[[nodiscard]] constexpr char to_lower(char character) noexcept
+{
+    return character >= 'A' && character <= 'Z' ? static_cast<char>(character - 'A' + 'a') : character;
+}
+
+/// @private outcome of building an index: the index itself and the order in which entries have to be stored
+template <typename Index, std::size_t N>
+struct build_result
+{
+    /// @private built index
+    Index index;
+    /// @private order[i] is the position (in the constructor's arguments) of the entry stored at i
+    std::array<std::size_t, N> order;
+};
+
+/// @private tag used to select the internal constructor that builds the index
+struct build_tag {};
+
+/// @private smallest unsigned type that can hold positions 0 ... N (N denotes "not found")
+template <std::size_t N>
+using position_t = std::conditional_t<(N <= UINT8_MAX), std::uint8_t,
+                   std::conditional_t<(N <= UINT16_MAX), std::uint16_t,
+                   std::conditional_t<(N <= UINT32_MAX), std::uint32_t, std::uint64_t>>>;
+
+/// @private converts integral or enumeration key to the unsigned type of the same size
+template <typename K>
+[[nodiscard]] constexpr auto to_unsigned(K key) noexcept
+{
+    if constexpr (std::is_enum_v<K>)
+    {
+        return to_unsigned(static_cast<std::underlying_type_t<K>>(key));
+    }
+    else if constexpr (std::is_same_v<K, bool>)
+    {
+        return static_cast<unsigned char>(key);
+    }
+    else
+    {
+        return static_cast<std::make_unsigned_t<K>>(key);
+    }
+}
+
+/// @private detects backends that provide their own (faster) check of the key's existence
+template <typename Index, typename Keys, typename K, typename = void>
+struct has_contains : std::false_type {};
+
+/// @private detects backends that provide their own (faster) check of the key's existence
+template <typename Index, typename Keys, typename K>
+struct has_contains<Index, Keys, K, std::void_t<decltype(std::declval<const Index&>().contains(std::declval<const Keys&>(), std::declval<const K&>()))>>
+: std::true_type {};
+
+/// @private detects backends that can prefetch memory, that their lookup of the key will need
+template <typename Index, typename Keys, typename K, typename = void>
+struct has_prefetch : std::false_type {};
+
+/// @private detects backends that can prefetch memory, that their lookup of the key will need
+template <typename Index, typename Keys, typename K>
+struct has_prefetch<Index, Keys, K, std::void_t<decltype(std::declval<const Index&>().prefetch(std::declval<const Keys&>(), std::declval<const K&>()))>>
+: std::true_type {};
+
+/// @private number of keys, for which batch lookups prefetch memory before they are searched for
+constexpr std::size_t batch_size = 16;
+
+/// @private whether the call happens during constant evaluation;
+///          if the compiler can't tell, it's always true, so that only constexpr code is used
+[[nodiscard]] constexpr bool is_constant_evaluated() noexcept
+{
+#if defined(CONSTEXPR_HASH_MAP_IS_CONSTANT_EVALUATED)
+    return CONSTEXPR_HASH_MAP_IS_CONSTANT_EVALUATED();
+#else
+    return true;
+#endif
+}
+
+/// @private index of the lowest set bit, value must not be zero
+[[nodiscard]] inline unsigned count_trailing_zeros(std::uint64_t value) noexcept
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    unsigned long index = 0;
+    _BitScanForward64(&index, value);
+
+    return static_cast<unsigned>(index);
+#else
+    return static_cast<unsigned>(__builtin_ctzll(value));
+#endif
+}
+
+/// @private hints the processor to load the cache line with given address, no-op if the compiler has no such intrinsic
+inline void prefetch([[maybe_unused]] const void* address) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(address);
+#elif defined(CONSTEXPR_HASH_MAP_AVX2) || defined(CONSTEXPR_HASH_MAP_SSE2)
+    _mm_prefetch(static_cast<const char*>(address), _MM_HINT_T0);
+#endif
+}
+
+/// @private moves the position at "root" down the max-heap of "count" positions, positions are ordered by the "less"
+template <std::size_t N, typename Less>
+constexpr void sift_down(std::array<std::size_t, N>& positions, std::size_t root, std::size_t count, const Less& less) noexcept
+{
+    for (auto child = 2 * root + 1; child < count; child = 2 * root + 1)
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+        if (child + 1 < count && less(positions[child], positions[child + 1]))
+        {
+            ++child;
+        }
+
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+        if (!less(positions[root], positions[child]))
+        {
+            return;
+        }
+
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+        const auto moved = positions[root];
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+        positions[root] = positions[child];
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+        positions[child] = moved;
+        root = child;
+    }
+}
+
+/// @private sorts positions, so that less(positions[i + 1], positions[i]) never holds;
+///          heap sort, because it's iterative and in-place (std::sort is not constexpr in C++17)
+template <std::size_t N, typename Less>
+constexpr void heap_sort(std::array<std::size_t, N>& positions, const Less& less) noexcept
+{
+    for (std::size_t root = N / 2; root > 0; --root)
+    {
+        sift_down(positions, root - 1, N, less);
+    }
+
+    for (std::size_t count = N; count > 1; --count)
+    {
+        const auto largest = positions[0];
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+        positions[0] = positions[count - 1];
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+        positions[count - 1] = largest;
+        sift_down(positions, 0, count - 1, less);
+    }
+}
+
+/// @private deliberately not constexpr, so that reaching it in constant evaluation makes the compilation fail
+inline void duplicate_keys_are_not_allowed() noexcept
+{
+}
+
+/// @private deliberately not constexpr, so that reaching it in constant evaluation makes the compilation fail
+inline void different_keys_with_the_same_hash_are_not_supported() noexcept
+{
+}
+
+/// @private deliberately not constexpr, so that reaching it in constant evaluation makes the compilation fail
+inline void no_seed_places_keys_of_the_bucket() noexcept
+{
+}
+
+/// @private detects hash function objects that can be called with the key
+template <typename Hash, typename K, typename = void>
+struct is_hashable : std::false_type {};
+
+/// @private detects hash function objects that can be called with the key
+template <typename Hash, typename K>
+struct is_hashable<Hash, K, std::void_t<decltype(Hash{}(std::declval<const K&>()))>> : std::true_type {};
+
+/// @private fails the constant evaluation, if any two of N keys are equal; if keys might be hashed,
+///          they are distributed to N buckets by hashes and only keys with the same hash are compared, otherwise all pairs are
+template <std::size_t N, typename Hash, typename KeyEqual, typename Keys>
+// NOLINTNEXTLINE(readability-function-cognitive-complexity)
+constexpr void ensure_unique(const Keys& keys) noexcept
+{
+    using key_type = std::decay_t<decltype(keys.key(0))>;
+
+    if constexpr (is_hashable<Hash, key_type>::value)
+    {
+        std::array<std::uint64_t, N> hashes{};
+        std::array<std::size_t, N + 1> bucket_starts{};
+
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+            hashes[i] = Hash{}(keys.key(i));
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+            ++bucket_starts[hashes[i] % N + 1];
+        }
+
+        // counting sort, so that the cost is linear (sorting would exhaust constexpr limits of the compiler sooner for big N)
+        for (std::size_t bucket = 0; bucket < N; ++bucket)
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+            bucket_starts[bucket + 1] += bucket_starts[bucket];
+        }
+
+        std::array<std::size_t, N> members{};
+        auto filled = bucket_starts;
+
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+            members[filled[hashes[i] % N]++] = i;
+        }
+
+        for (std::size_t bucket = 0; bucket < N; ++bucket)
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+            for (auto i = bucket_starts[bucket]; i < bucket_starts[bucket + 1]; ++i)
+            {
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+                for (auto j = i + 1; j < bucket_starts[bucket + 1]; ++j)
+                {
+                    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+                    if (hashes[members[i]] == hashes[members[j]] && KeyEqual{}(keys.key(members[i]), keys.key(members[j])))
+                    {
+                        duplicate_keys_are_not_allowed();
+                    }
+                }
+            }
+        }
+    }
+    else
+    {
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            for (auto j = i + 1; j < N; ++j)
+            {
+                if (KeyEqual{}(keys.key(i), keys.key(j)))
+                {
+                    duplicate_keys_are_not_allowed();
+                }
+            }
+        }
+    }
+}
+
+/// @private detects function objects marked by the "is_transparent" member type
+template <typename T, typename = void>
+struct is_transparent : std::false_type {};
+
+/// @private detects function objects marked by the "is_transparent" member type
+template <typename T>
+struct is_transparent<T, std::void_t<typename T::is_transparent>> : std::true_type {};
+
+/// @private query of other type than the key might be looked up, if both Hash and KeyEqual are transparent
+template <typename Hash, typename KeyEqual, typename K, typename Query>
+constexpr bool is_heterogeneous_v = is_transparent<Hash>::value && is_transparent<KeyEqual>::value && !std::is_same_v<Query, K>;
+
+/// @private KeyEqual given to the hash_map, if the backend got the one wrapped by the instrumentation (see instrumentation::counting)
+template <typename KeyEqual, typename = void>
+struct uninstrumented
+{
+    using type = KeyEqual;
+};
+
+/// @private KeyEqual given to the hash_map, if the backend got the one wrapped by the instrumentation (see instrumentation::counting)
+template <typename KeyEqual>
+struct uninstrumented<KeyEqual, std::void_t<typename KeyEqual::uninstrumented_type>>
+{
+    using type = typename KeyEqual::uninstrumented_type;
+};
+
+/// @private see the uninstrumented, fast paths of backends for the default ct::equal_to are taken regardless of the instrumentation
+template <typename KeyEqual>
+using uninstrumented_t = typename uninstrumented<KeyEqual>::type;
+
+/// @private counts a comparison of keys, that a fast path of the backend made without calling the (instrumented) KeyEqual
+template <typename KeyEqual>
+constexpr void count_comparison() noexcept
+{
+    if constexpr (!std::is_same_v<KeyEqual, uninstrumented_t<KeyEqual>>)
+    {
+        KeyEqual::count();
+    }
+}
+
+/// @private detects backends that keep elements ordered by keys
+template <typename Index, typename = void>
+struct is_ordered : std::false_type {};
+
+/// @private detects backends that keep elements ordered by keys
+template <typename Index>
+struct is_ordered<Index, std::enable_if_t<Index::ordered>> : std::true_type {};
+
+/// @private vectorized comparisons used by the backends at runtime (never in constexpr context)
+namespace simd
+{
+#if defined(CONSTEXPR_HASH_MAP_AVX2)
+/// @private number of bytes compared at once
+constexpr std::size_t width = 32;
+/// @private number of bits of a mask per compared byte
+constexpr unsigned bits_per_byte = 1;
+/// @private number of bits of a mask per compared 32-bit word
+constexpr unsigned bits_per_word = 1;
+#elif defined(CONSTEXPR_HASH_MAP_SSE2)
+/// @private number of bytes compared at once
+constexpr std::size_t width = 16;
+/// @private number of bits of a mask per compared byte
+constexpr unsigned bits_per_byte = 1;
+/// @private number of bits of a mask per compared 32-bit word
+constexpr unsigned bits_per_word = 1;
+#elif defined(CONSTEXPR_HASH_MAP_NEON)
+/// @private number of bytes compared at once
+constexpr std::size_t width = 16;
+/// @private number of bits of a mask per compared byte
+constexpr unsigned bits_per_byte = 4;
+/// @private number of bits of a mask per compared 32-bit word
+constexpr unsigned bits_per_word = 16;
+#else
+/// @private no vector instructions available, bytes are compared one by one
+constexpr std::size_t width = 1;
+#endif
+
+/// @private number of 32-bit words compared at once
+constexpr std::size_t word_width = width < sizeof(std::uint32_t) ? 1 : width / sizeof(std::uint32_t);
+
+/// @private maximal number of keys, for which the backend::linear keeps a copy of 32-bit keys to scan them with vector instructions
+constexpr std::size_t word_scan_limit = 64;
+
+/// @private number of bytes rounded up to the whole blocks of the "width"
+[[nodiscard]] constexpr std::size_t padded(std::size_t count) noexcept
+{
+    return (count + width - 1) / width * width;
+}
+
+/// @private number of 32-bit words rounded up to the whole blocks of the "word_width"
+[[nodiscard]] constexpr std::size_t padded_words(std::size_t count) noexcept
+{
+    return (count + word_width - 1) / word_width * word_width;
+}
+
+#if defined(CONSTEXPR_HASH_MAP_AVX2) || defined(CONSTEXPR_HASH_MAP_SSE2) || defined(CONSTEXPR_HASH_MAP_NEON)
+/// @private compares "width" bytes against the needle, returns mask with "bits_per_byte" bits set for every match
+[[nodiscard]] inline std::uint64_t match(const std::uint8_t* bytes, std::uint8_t needle) noexcept
+{
+#if defined(CONSTEXPR_HASH_MAP_AVX2)
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    const auto block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(bytes));
+    const auto matches = _mm256_cmpeq_epi8(block, _mm256_set1_epi8(static_cast<char>(needle)));
+
+    return static_cast<std::uint32_t>(_mm256_movemask_epi8(matches));
+#elif defined(CONSTEXPR_HASH_MAP_SSE2)
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    const auto block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes));
+    const auto matches = _mm_cmpeq_epi8(block, _mm_set1_epi8(static_cast<char>(needle)));
+
+    return static_cast<std::uint16_t>(_mm_movemask_epi8(matches));
+#else
+    constexpr unsigned nibble_shift = 4;
+    const auto matches = vceqq_u8(vld1q_u8(bytes), vdupq_n_u8(needle));
+    // narrowing shift packs each 8-bit comparison result into 4 bits
+    const auto packed = vshrn_n_u16(vreinterpretq_u16_u8(matches), nibble_shift);
+
+    return vget_lane_u64(vreinterpret_u64_u8(packed), 0);
+#endif
+}
+
+/// @private compares "word_width" 32-bit words against the needle, returns mask with "bits_per_word" bits set for every match
+[[nodiscard]] inline std::uint64_t match(const std::uint32_t* words, std::uint32_t needle) noexcept
+{
+#if defined(CONSTEXPR_HASH_MAP_AVX2)
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    const auto block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(words));
+    const auto matches = _mm256_cmpeq_epi32(block, _mm256_set1_epi32(static_cast<int>(needle)));
+
+    return static_cast<std::uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(matches)));
+#elif defined(CONSTEXPR_HASH_MAP_SSE2)
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    const auto block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(words));
+    const auto matches = _mm_cmpeq_epi32(block, _mm_set1_epi32(static_cast<int>(needle)));
+
+    return static_cast<std::uint32_t>(_mm_movemask_ps(_mm_castsi128_ps(matches)));
+#else
+    const auto matches = vceqq_u32(vld1q_u32(words), vdupq_n_u32(needle));
+
+    // narrowing packs each 32-bit comparison result into 16 bits
+    return vget_lane_u64(vreinterpret_u64_u16(vmovn_u32(matches)), 0);
+#endif
+}
+#endif
+
+/// @private finds position of the 32-bit word equal to the needle, "count" if there's none;
+///          words must be unique and readable up to "count" rounded up to the "word_width"
+[[nodiscard]] inline std::size_t find(const std::uint32_t* words, std::size_t count, std::uint32_t needle) noexcept
+{
+#if defined(CONSTEXPR_HASH_MAP_AVX2) || defined(CONSTEXPR_HASH_MAP_SSE2) || defined(CONSTEXPR_HASH_MAP_NEON)
+    // keeps one bit per compared word
+    constexpr std::uint64_t lowest_bits = bits_per_word == 1 ? ~std::uint64_t{0} : 0x0001000100010001ULL;
+
+    for (std::size_t block = 0; block < count; block += word_width)
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        const auto mask = match(words + block, needle) & lowest_bits;
+
+        if (mask != 0)
+        {
+            // padding follows the words, so the first match is the only valid one
+            const auto position = block + count_trailing_zeros(mask) / bits_per_word;
+
+            return position < count ? position : count;
+        }
+    }
+#else
+    for (std::size_t position = 0; position < count; ++position)
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        if (words[position] == needle)
+        {
+            return position;
+        }
+    }
+#endif
+
+    return count;
+}
+
+/// @private finds position of the first byte equal to the needle, for which the predicate holds, "count" if there's none;
+///          bytes must be readable up to "count" rounded up to the "width"
+template <typename Predicate>
+[[nodiscard]] inline std::size_t find(const std::uint8_t* bytes, std::size_t count, std::uint8_t needle, Predicate&& predicate) noexcept
+{
+#if defined(CONSTEXPR_HASH_MAP_AVX2) || defined(CONSTEXPR_HASH_MAP_SSE2) || defined(CONSTEXPR_HASH_MAP_NEON)
+    // keeps one bit per compared byte
+    constexpr std::uint64_t lowest_bits = bits_per_byte == 1 ? ~std::uint64_t{0} : 0x1111111111111111ULL;
+
+    for (std::size_t block = 0; block < count; block += width)
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        auto mask = match(bytes + block, needle) & lowest_bits;
+
+        while (mask != 0)
+        {
+            const auto position = block + count_trailing_zeros(mask) / bits_per_byte;
+
+            if (position >= count)
+            {
+                break;
+            }
+
+            if (predicate(position))
+            {
+                return position;
+            }
+
+            mask &= mask - 1;
+        }
+    }
+#else
+    for (std::size_t position = 0; position < count; ++position)
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        if (bytes[position] == needle && predicate(position))
+        {
+            return position;
+        }
+    }
+#endif
+
+    return count;
+}
+}  // namespace simd
+
+/// @private random-access iterator over storages that don't keep keys and values in pairs;
+///          dereferencing gives a pair of references (key, value) created on the fly
+template <typename Storage>
+class proxy_iterator
+{
+public:
+    /// @private pair of references to the key and the value
+    using reference = std::pair<decltype(std::declval<const Storage&>().key(0)), decltype(std::declval<const Storage&>().value(0))>;
+    /// @private copy of the key and the value
+    using value_type = std::pair<std::decay_t<typename reference::first_type>, std::decay_t<typename reference::second_type>>;
+    /// @private signed distance between iterators
+    using difference_type = std::ptrdiff_t;
+    /// @private iterators are used for the std::next(...) with O(1) complexity, so they report being random-access
+    using iterator_category = std::random_access_iterator_tag;
+
+    /// @private holds the pair, so that the operator-> has somewhere to point to
+    struct pointer
+    {
+        /// @private pair created by dereferencing the iterator
+        reference element;
+
+        /// @private gives access to the members of the pair
+        // NOLINTNEXTLINE(fuchsia-overloaded-operator)
+        [[nodiscard]] constexpr const reference* operator->() const noexcept
+        {
+            return &element;
+        }
+    };
+
+    /// @private singular iterator (forward iterators have to be default-constructible, e.g. to hold results of the find_many)
+    constexpr proxy_iterator() noexcept = default;
+
+    /// @private iterator to the element at given position
+    constexpr proxy_iterator(const Storage& storage, std::size_t position) noexcept
+    : elements{&storage}, current{position}
+    {
+    }
+
+    /// @private key and value of the current element
+    // NOLINTNEXTLINE(fuchsia-overloaded-operator)
+    [[nodiscard]] constexpr reference operator*() const noexcept
+    {
+        return {elements->key(current), elements->value(current)};
+    }
+
+    /// @private access to the key and value of the current element
+    // NOLINTNEXTLINE(fuchsia-overloaded-operator)
+    [[nodiscard]] constexpr pointer operator->() const noexcept
+    {
+        return {**this};
+    }
+
+    /// @private key and value of the element at given offset
+    // NOLINTNEXTLINE(fuchsia-overloaded-operator)
+    [[nodiscard]] constexpr reference operator[](difference_type offset) const noexcept
+    {
+        return *(*this + offset);
+    }
+
+    /// @private moves to the next element
+    // NOLINTNEXTLINE(fuchsia-overloaded-operator)
+    constexpr proxy_iterator& operator++() noexcept
+    {
+        ++current;
+
+        return *this;
+    }
+
+    /// @private moves to the next element
+    // NOLINTNEXTLINE(fuchsia-overloaded-operator)
+    constexpr proxy_iterator operator++(int) noexcept
+    {
+        auto previous = *this;
+        ++current;
+
+        return previous;
+    }
+
+    /// @private moves to the previous element
+    // NOLINTNEXTLINE(fuchsia-overloaded-operator)
+    constexpr proxy_iterator& operator--() noexcept
+    {
+        --current;
+
+        return *this;
+    }
+
+    /// @private moves to the previous element
+    // NOLINTNEXTLINE(fuchsia-overloaded-operator)
+    constexpr proxy_iterator operator--(int) noexcept
+    {
+        auto previous = *this;
+        --current;
+
+        return previous;
+    }
+
+    /// @private moves by given offset
+    // NOLINTNEXTLINE(fuchsia-overloaded-operator)
+    constexpr proxy_iterator& operator+=(difference_type offset) noexcept
+    {
+        current = static_cast<std::size_t>(static_cast<difference_type>(current) + offset);
+
+        return *this;
+    }
+
+    /// @private moves back by given offset
+    // NOLINTNEXTLINE(fuchsia-overloaded-operator)
+    constexpr proxy_iterator& operator-=(difference_type offset) noexcept
+    {
+        return *this += -offset;
+    }
+
+    /// @private iterator moved by given offset
+    // NOLINTNEXTLINE(fuchsia-overloaded-operator)
+    [[nodiscard]] constexpr proxy_iterator operator+(difference_type offset) const noexcept
+    {
+        auto moved = *this;
+
+        return moved += offset;
+    }
+
+    /// @private iterator moved back by given offset
+    // NOLINTNEXTLINE(fuchsia-overloaded-operator)
+    [[nodiscard]] constexpr proxy_iterator operator-(difference_type offset) const noexcept
+    {
+        auto moved = *this;
+
+        return moved -= offset;
+    }
+
+    /// @private distance between iterators
+    // NOLINTNEXTLINE(fuchsia-overloaded-operator)
+    [[nodiscard]] constexpr difference_type operator-(const proxy_iterator& other) const noexcept
+    {
+        return static_cast<difference_type>(current) - static_cast<difference_type>(other.current);
+    }
+
+    /// @private iterators are equal, if they point to the same element
+    // NOLINTNEXTLINE(fuchsia-overloaded-operator)
+    [[nodiscard]] constexpr bool operator==(const proxy_iterator& other) const noexcept
+    {
+        return current == other.current && elements == other.elements;
+    }
+
+    /// @private negation of the operator==
+    // NOLINTNEXTLINE(fuchsia-overloaded-operator)
+    [[nodiscard]] constexpr bool operator!=(const proxy_iterator& other) const noexcept
+    {
+        return !(*this == other);
+    }
+
+    /// @private order of the elements
+    // NOLINTNEXTLINE(fuchsia-overloaded-operator)
+    [[nodiscard]] constexpr bool operator<(const proxy_iterator& other) const noexcept
+    {
+        return current < other.current;
+    }
+
+    /// @private order of the elements
+    // NOLINTNEXTLINE(fuchsia-overloaded-operator)
+    [[nodiscard]] constexpr bool operator>(const proxy_iterator& other) const noexcept
+    {
+        return other < *this;
+    }
+
+    /// @private order of the elements
+    // NOLINTNEXTLINE(fuchsia-overloaded-operator)
+    [[nodiscard]] constexpr bool operator<=(const proxy_iterator& other) const noexcept
+    {
+        return !(other < *this);
+    }
+
+    /// @private order of the elements
+    // NOLINTNEXTLINE(fuchsia-overloaded-operator)
+    [[nodiscard]] constexpr bool operator>=(const proxy_iterator& other) const noexcept
+    {
+        return !(*this < other);
+    }
+
+private:
+    const Storage* elements = nullptr;
+    std::size_t current = 0;
+};
+
+/// @private whether the type is one of the supported string types ("const char*" or std::string_view)
+template <typename T>
+constexpr bool is_string_v = std::is_same_v<T, const char*> || std::is_same_v<T, std::string_view>;
+
+/// @private N null-terminated strings packed one after another into an array of "Bytes" characters
+template <std::size_t N, std::size_t Bytes>
+class pooled_strings
+{
+    static_assert(Bytes <= UINT32_MAX, "Strings are addressed by 32-bit offsets");
+
+public:
+    /// @private copies strings given by the function object (called with 0 ... N - 1) to the pool
+    template <typename Strings>
+    [[nodiscard]] static constexpr pooled_strings pack(const Strings& strings) noexcept
+    {
+        pooled_strings pool{};
+
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            const std::string_view text{strings(i)};
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+            const auto first = pool.offsets[i];
+
+            if (Bytes - first <= text.size())
+            {
+                // doesn't fit, nothing is written out of bounds and the constant evaluation fails
+                string_pool_is_too_small();
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+                pool.offsets[i + 1] = first;
+
+                continue;
+            }
+
+            for (std::size_t character = 0; character < text.size(); ++character)
+            {
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+                pool.characters[first + character] = text[character];
+            }
+
+            // terminating null character is already there, the array is zero-initialized
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+            pool.offsets[i + 1] = static_cast<std::uint32_t>(first + text.size() + 1);
+        }
+
+        return pool;
+    }
+
+    /// @private i-th string as a "const char*" or std::string_view
+    template <typename S>
+    [[nodiscard]] constexpr S get(std::size_t i) const noexcept
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic, cppcoreguidelines-pro-bounds-constant-array-index)
+        const auto* begin = characters.data() + offsets[i];
+
+        if constexpr (std::is_same_v<S, const char*>)
+        {
+            return begin;
+        }
+        else
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+            return S{begin, static_cast<std::size_t>(offsets[i + 1] - offsets[i] - 1)};
+        }
+    }
+
+private:
+    /// @private deliberately not constexpr, so that reaching it in constant evaluation makes the compilation fail
+    static void string_pool_is_too_small() noexcept
+    {
+    }
+
+    std::array<char, Bytes> characters{};
+    std::array<std::uint32_t, N + 1> offsets{};
+};
+}  // namespace detail
+
+/// @brief Default hash function object of the ct::hash_map, gives 64-bit hashes and is usable in constexpr context.
+///        Specialized for integral types, enumerations, "const char*" and std::string_view;
+///        the primary template is not callable (same as a disabled std::hash), but it might be specialized for custom keys.
+/// @tparam K data type for keys
+template <typename K, typename = void>
+struct hash
+{
+};
+
+/// @brief Hashes integral and enumeration keys by mixing their bits (splitmix64).
+template <typename K>
+struct hash<K, std::enable_if_t<std::is_integral_v<K> || std::is_enum_v<K>>>
+{
+    /// @brief Computes the hash.
+    /// @param key key to be hashed
+    /// @return 64-bit hash
+    // NOLINTNEXTLINE(fuchsia-overloaded-operator)
+    [[nodiscard]] constexpr std::uint64_t operator()(K key) const noexcept
+    {
+        if constexpr (std::is_enum_v<K>)
+        {
+            return hash<std::underlying_type_t<K>>{}(static_cast<std::underlying_type_t<K>>(key));
+        }
+        else
+        {
+            return detail::mix(static_cast<std::uint64_t>(detail::to_unsigned(key)) + detail::golden_ratio);
+        }
+    }
+};
+
+/// @brief Hashes strings using the 64-bit FNV-1a.
+template <>
+struct hash<std::string_view>
+{
+    /// @brief Computes the hash.
+    /// @param key key to be hashed
+    /// @return 64-bit hash
+    // NOLINTNEXTLINE(fuchsia-overloaded-operator)
+    [[nodiscard]] constexpr std::uint64_t operator()(std::string_view key) const noexcept
+    {
+        return detail::fnv1a(key);
+    }
+};
+
+/// @brief Hashes null-terminated strings the same way as the std::string_view.
+template <>
+struct hash<const char*>
+{
+    /// @brief std::string_view might be looked up in maps with "const char*" keys (heterogeneous lookup)
+    using is_transparent = void;
+
+    /// @brief Computes the hash.
+    /// @param key key to be hashed
+    /// @return 64-bit hash
+    // NOLINTNEXTLINE(fuchsia-overloaded-operator)
+    [[nodiscard]] constexpr std::uint64_t operator()(const char* key) const noexcept
+    {
+        return detail::fnv1a(key);
+    }
+
+    /// @brief Computes the same hash as for the null-terminated string with the same characters.
+    /// @param key searched characters, need not be null-terminated
+    /// @return 64-bit hash
+    // NOLINTNEXTLINE(fuchsia-overloaded-operator)
+    [[nodiscard]] constexpr std::uint64_t operator()(std::string_view key) const noexcept
+    {
+        return detail::fnv1a(key);
+    }
+};
+
+/// @brief Default key comparison of the ct::hash_map, uses the operator==.
+/// @tparam K data type for keys
+template <typename K>
+struct equal_to
+{
+    /// @brief Compares keys.
+    /// @param lhs first key
+    /// @param rhs second key
+    /// @return whether keys are equal
+    // NOLINTNEXTLINE(fuchsia-overloaded-operator)
+    [[nodiscard]] constexpr bool operator()(const K& lhs, const K& rhs) const noexcept
+    {
+        return lhs == rhs;
+    }
+};
+
+/// @brief Compares contents of null-terminated strings (not the pointers); iterative, lengths are compared first.
+template <>
+struct equal_to<const char*>
+{
+    /// @brief std::string_view might be looked up in maps with "const char*" keys (heterogeneous lookup)
+    using is_transparent = void;
+
+    /// @brief Compares keys.
+    /// @param lhs first key
+    /// @param rhs second key
+    /// @return whether strings are equal
+    // NOLINTNEXTLINE(fuchsia-overloaded-operator)
+    [[nodiscard]] constexpr bool operator()(const char* lhs, const char* rhs) const noexcept
+    {
+        const auto count = detail::length(lhs);
+
+        return count == detail::length(rhs) && detail::equal(lhs, rhs, count);
+    }
+
+    /// @brief Compares key with characters that need not be null-terminated.
+    /// @param lhs key
+    /// @param rhs searched characters
+    /// @return whether strings are equal
+    // NOLINTNEXTLINE(fuchsia-overloaded-operator)
+    [[nodiscard]] constexpr bool operator()(const char* lhs, std::string_view rhs) const noexcept
+    {
+        return detail::length(lhs) == rhs.size() && detail::equal(lhs, rhs.data(), rhs.size());
+    }
+
+    /// @brief Compares characters that need not be null-terminated with key.
+    /// @param lhs searched characters
+    /// @param rhs key
+    /// @return whether strings are equal
+    // NOLINTNEXTLINE(fuchsia-overloaded-operator)
+    [[nodiscard]] constexpr bool operator()(std::string_view lhs, const char* rhs) const noexcept
+    {
+        return (*this)(rhs, lhs);
+    }
+};
+
+/// @brief Hashes strings ("const char*" or std::string_view) ignoring case of ASCII letters, e.g. for HTTP header names.
+/// @see case_insensitive_equal_to
+struct case_insensitive_hash
+{
+    /// @brief any string type convertible to the std::string_view might be looked up (heterogeneous lookup)
+    using is_transparent = void;
+
+    /// @brief Computes FNV-1a of the lower-cased string.
+    /// @param key key to be hashed
+    /// @return 64-bit hash
+    // NOLINTNEXTLINE(fuchsia-overloaded-operator)
+    [[nodiscard]] constexpr std::uint64_t operator()(std::string_view key) const noexcept
+    {
+        std::uint64_t hash = detail::fnv_offset_basis;
+
+        for (const char character : key)
+        {
+            hash = (hash ^ static_cast<unsigned char>(detail::to_lower(character))) * detail::fnv_prime;
+        }
+
+        return hash;
+    }
+};
+
+/// @brief Compares strings ("const char*" or std::string_view) ignoring case of ASCII letters.
+/// @see case_insensitive_hash
+struct case_insensitive_equal_to
+{
+    /// @brief any string type convertible to the std::string_view might be looked up (heterogeneous lookup)
+    using is_transparent = void;
+
+    /// @brief Compares keys.
+    /// @param lhs first key
+    /// @param rhs second key
+    /// @return whether strings are equal, if case is ignored
+    // NOLINTNEXTLINE(fuchsia-overloaded-operator)
+    [[nodiscard]] constexpr bool operator()(std::string_view lhs, std::string_view rhs) const noexcept
+    {
+        if (lhs.size() != rhs.size())
+        {
+            return false;
+        }
+
+        for (std::size_t i = 0; i < lhs.size(); ++i)
+        {
+            if (detail::to_lower(lhs[i]) != detail::to_lower(rhs[i]))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+};
+
+/// @brief Default ordering of keys used by the backend::sorted and backend::eytzinger, uses the operator<.
+/// @tparam K data type for keys
+template <typename K>
+struct less
+{
+    /// @brief Compares keys.
+    /// @param lhs first key
+    /// @param rhs second key
+    /// @return whether the first key goes before the second one
+    // NOLINTNEXTLINE(fuchsia-overloaded-operator)
+    [[nodiscard]] constexpr bool operator()(const K& lhs, const K& rhs) const noexcept
+    {
+        return lhs < rhs;
+    }
+};
+
+/// @brief Orders null-terminated strings lexicographically by their contents (not by the pointers).
+template <>
+struct less<const char*>
+{
+    /// @brief std::string_view might be looked up in maps with "const char*" keys (heterogeneous lookup)
+    using is_transparent = void;
+
+    /// @brief Compares keys.
+    /// @param lhs first key (or searched characters)
+    /// @param rhs second key (or searched characters)
+    /// @return whether the first string goes before the second one
+    // NOLINTNEXTLINE(fuchsia-overloaded-operator)
+    [[nodiscard]] constexpr bool operator()(std::string_view lhs, std::string_view rhs) const noexcept
+    {
+        return lhs < rhs;
+    }
+};
+
+/// @brief Orders strings ("const char*" or std::string_view) lexicographically ignoring case of ASCII letters.
+/// @see case_insensitive_equal_to
+struct case_insensitive_less
+{
+    /// @brief any string type convertible to the std::string_view might be looked up (heterogeneous lookup)
+    using is_transparent = void;
+
+    /// @brief Compares keys.
+    /// @param lhs first key
+    /// @param rhs second key
+    /// @return whether the first string goes before the second one, if case is ignored
+    // NOLINTNEXTLINE(fuchsia-overloaded-operator)
+    [[nodiscard]] constexpr bool operator()(std::string_view lhs, std::string_view rhs) const noexcept
+    {
+        const auto count = lhs.size() < rhs.size() ? lhs.size() : rhs.size();
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const auto left = static_cast<unsigned char>(detail::to_lower(lhs[i]));
+            const auto right = static_cast<unsigned char>(detail::to_lower(rhs[i]));
+
+            if (left != right)
+            {
+                return left < right;
+            }
+        }
+
+        return lhs.size() < rhs.size();
+    }
+};
+
+/// @brief Lookup strategies of the backends, see the hash_map::backend().
+enum class backend_kind
+{
+    /// @brief backend::linear
+    linear,
+    /// @brief backend::fingerprint
+    fingerprint,
+    /// @brief backend::dense
+    dense,
+    /// @brief backend::perfect_hash
+    perfect_hash,
+    /// @brief backend::sorted
+    sorted,
+    /// @brief backend::eytzinger
+    eytzinger,
+    /// @brief backend defined outside of this library
+    custom
+};
+
+/// @brief Backends (lookup strategies) that might be passed as the Backend template argument of the ct::hash_map.
+namespace backend
+{
+/// @brief Linear scan over all the entries, performs O(N) comparisons; needs just the KeyEqual, Hash is not used.
+///        Elements are stored in the same order as they were passed to the constructor.
+/// @details For "const char*" keys (compared by the default ct::equal_to) lengths of keys are stored, so that the searched key's length is computed just once
+///          and keys of different lengths are rejected without touching their characters.
+///          For at most 64 integral or enumeration keys of 32 bits (compared by the default ct::equal_to) a contiguous copy of keys is stored
+///          and at runtime it's scanned using SSE2 or NEON (4 keys per instruction) or AVX2 (8 keys per instruction).
+struct linear
+{
+    /// @private lookup strategy reported by the hash_map::backend()
+    static constexpr backend_kind kind = backend_kind::linear;
+
+    /// @private lookup structure of the backend, stores lengths of "const char*" keys (nothing otherwise)
+    template <std::size_t N, typename K, typename Hash, typename KeyEqual>
+    class index
+    {
+    public:
+        /// @private entries are left in order in which they were given, fails the constant evaluation on duplicate keys
+        template <typename Keys>
+        [[nodiscard]] static CONSTEXPR_HASH_MAP_BUILD detail::build_result<index, N> build(const Keys& keys) noexcept
+        {
+            detail::ensure_unique<N, Hash, KeyEqual>(keys);
+            detail::build_result<index, N> result{};
+
+            for (std::size_t i = 0; i < N; ++i)
+            {
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+                result.order[i] = i;
+
+                if constexpr (stores_lengths)
+                {
+                    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+                    result.index.lengths[i] = static_cast<std::uint32_t>(detail::length(keys.key(i)));
+                }
+
+                if constexpr (stores_words)
+                {
+                    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+                    result.index.words[i] = static_cast<std::uint32_t>(keys.key(i));
+                }
+            }
+
+            return result;
+        }
+
+        /// @private returns position of the key, N if not found
+        /// @details Iterative, so neither the constexpr depth nor the number of instantiations grow with N
+        template <typename Keys, typename Query>
+        [[nodiscard]] constexpr std::size_t find(const Keys& keys, const Query& key) const noexcept
+        {
+            if constexpr (stores_lengths)
+            {
+                // "const char*" or std::string_view (for heterogeneous lookup)
+                const std::string_view characters{key};
+
+                for (std::size_t i = 0; i < N; ++i)
+                {
+                    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+                    if (lengths[i] == characters.size())
+                    {
+                        detail::count_comparison<KeyEqual>();
+
+                        if (detail::equal(keys.key(i), characters.data(), characters.size()))
+                        {
+                            return i;
+                        }
+                    }
+                }
+            }
+            else
+            {
+                if constexpr (stores_words && std::is_same_v<Query, K>)
+                {
+                    if (!detail::is_constant_evaluated())
+                    {
+                        return detail::simd::find(words.data(), N, static_cast<std::uint32_t>(key));
+                    }
+                }
+
+                for (std::size_t i = 0; i < N; ++i)
+                {
+                    if (KeyEqual{}(keys.key(i), key))
+                    {
+                        return i;
+                    }
+                }
+            }
+
+            return N;
+        }
+
+    private:
+        static constexpr bool stores_lengths = std::is_same_v<K, const char*> && std::is_same_v<detail::uninstrumented_t<KeyEqual>, equal_to<const char*>>;
+
+        static constexpr bool stores_words = (std::is_integral_v<K> || std::is_enum_v<K>) && !std::is_same_v<K, bool> && sizeof(K) == sizeof(std::uint32_t)
+                                             && std::is_same_v<detail::uninstrumented_t<KeyEqual>, equal_to<K>> && N <= detail::simd::word_scan_limit;
+
+        std::array<std::uint32_t, stores_lengths ? N : 0> lengths{};
+        std::array<std::uint32_t, stores_words ? detail::simd::padded_words(N) : 0> words{};
+    };
+};
+
+/// @brief Linear scan as the backend::linear, but every key is accompanied by an 8-bit fingerprint (part of its hash),
+///        so keys are compared only when fingerprints match.
+/// @details Searched key is hashed once; at runtime fingerprints are compared using SSE2 or NEON (16 per instruction)
+///          or AVX2 (32 per instruction), in constexpr context a plain loop is used.
+///          Elements are stored in the same order as they were passed to the constructor.
+struct fingerprint
+{
+    /// @private lookup strategy reported by the hash_map::backend()
+    static constexpr backend_kind kind = backend_kind::fingerprint;
+
+    /// @private lookup structure of the backend, stores one byte per key
+    template <std::size_t N, typename K, typename Hash, typename KeyEqual>
+    class index
+    {
+    public:
+        /// @private computes fingerprints, entries are left in order in which they were given; fails the constant evaluation on duplicate keys
+        template <typename Keys>
+        [[nodiscard]] static CONSTEXPR_HASH_MAP_BUILD detail::build_result<index, N> build(const Keys& keys) noexcept
+        {
+            detail::ensure_unique<N, Hash, KeyEqual>(keys);
+            detail::build_result<index, N> result{};
+
+            for (std::size_t i = 0; i < N; ++i)
+            {
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+                result.order[i] = i;
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+                result.index.fingerprints[i] = fingerprint_of(Hash{}(keys.key(i)));
+            }
+
+            return result;
+        }
+
+        /// @private returns position of the key, N if not found
+        template <typename Keys, typename Query>
+        [[nodiscard]] constexpr std::size_t find(const Keys& keys, const Query& key) const noexcept
+        {
+            const auto needle = fingerprint_of(Hash{}(key));
+
+            if (!detail::is_constant_evaluated())
+            {
+                return detail::simd::find(fingerprints.data(), N, needle, [&](std::size_t i) { return KeyEqual{}(keys.key(i), key); });
+            }
+
+            for (std::size_t i = 0; i < N; ++i)
+            {
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+                if (fingerprints[i] == needle && KeyEqual{}(keys.key(i), key))
+                {
+                    return i;
+                }
+            }
+
+            return N;
+        }
+
+    protected:
+        /// @private top byte of the hash
+        [[nodiscard]] static constexpr std::uint8_t fingerprint_of(std::uint64_t hash) noexcept
+        {
+            constexpr unsigned shift = 56;
+
+            return static_cast<std::uint8_t>(hash >> shift);
+        }
+
+    private:
+        // padded, so that vectorized comparisons might read whole blocks
+        std::array<std::uint8_t, detail::simd::padded(N)> fingerprints{};
+    };
+};
+
+/// @brief Direct lookup table for integral and enumeration keys (compared by value) that lie in a narrow range:
+///        if the difference of the largest and the smallest key is below max(4 * N, 64), lookup is just
+///        a bounds check and a read of the presence bitmap (and of the table of positions for the find).
+///        Otherwise the index falls back to the linear scan, it's decided in the constructor from the actual keys.
+/// @details This is the default backend for integral and enumeration keys compared by the ct::equal_to.
+///          Elements are stored in the same order as they were passed to the constructor.
+struct dense
+{
+    /// @private lookup strategy reported by the hash_map::backend()
+    static constexpr backend_kind kind = backend_kind::dense;
+
+    /// @private lookup structure of the backend: the smallest key, presence bitmap and table of positions;
+    ///          the table has at most CapacityLimit slots (multiple of 64), used by the backend::automatic to bound the size of the unused table
+    template <std::size_t N, typename K, typename Hash, typename KeyEqual, std::size_t CapacityLimit = SIZE_MAX>
+    class index
+    {
+        static_assert(std::is_integral_v<K> || std::is_enum_v<K>, "Dense backend needs integral or enumeration keys");
+
+    public:
+        /// @private fills the table if keys are in the narrow range, entries are left in order in which they were given;
+        ///          fails the constant evaluation on duplicate keys
+        template <typename Keys>
+        [[nodiscard]] static CONSTEXPR_HASH_MAP_BUILD detail::build_result<index, N> build(const Keys& keys) noexcept
+        {
+            detail::build_result<index, N> result{};
+            auto& table = result.index;
+            auto largest = keys.key(0);
+            table.smallest = keys.key(0);
+
+            for (std::size_t i = 0; i < N; ++i)
+            {
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+                result.order[i] = i;
+
+                const auto key = keys.key(i);
+                table.smallest = underlying(key) < underlying(table.smallest) ? key : table.smallest;
+                largest = underlying(largest) < underlying(key) ? key : largest;
+            }
+
+            table.direct = table.offset_of(largest) < capacity;
+
+            for (std::size_t i = 0; i < N && table.direct; ++i)
+            {
+                const auto offset = table.offset_of(keys.key(i));
+
+                if (table.is_present(offset))
+                {
+                    detail::duplicate_keys_are_not_allowed();
+                }
+
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+                table.positions[offset] = static_cast<detail::position_t<N>>(i);
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+                table.present[offset / word_bits] |= std::uint64_t{1} << (offset % word_bits);
+            }
+
+            if (!table.direct)
+            {
+                // keys are too sparse for the table, so duplicates are searched for among the sorted ones
+                auto positions = result.order;
+                detail::heap_sort(positions, [&keys](std::size_t lhs, std::size_t rhs) { return underlying(keys.key(lhs)) < underlying(keys.key(rhs)); });
+
+                for (std::size_t i = 1; i < N; ++i)
+                {
+                    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+                    if (keys.key(positions[i - 1]) == keys.key(positions[i]))
+                    {
+                        detail::duplicate_keys_are_not_allowed();
+                    }
+                }
+            }
+
+            return result;
+        }
+
+        /// @private returns position of the key, N if not found
+        template <typename Keys>
+        [[nodiscard]] constexpr std::size_t find(const Keys& keys, const K& key) const noexcept
+        {
+            if (direct)
+            {
+                const auto offset = offset_of(key);
+
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+                return offset < capacity && is_present(offset) ? positions[offset] : N;
+            }
+
+            for (std::size_t i = 0; i < N; ++i)
+            {
+                if (keys.key(i) == key)
+                {
+                    return i;
+                }
+            }
+
+            return N;
+        }
+
+        /// @private checks existence of the key using just the presence bitmap
+        template <typename Keys>
+        [[nodiscard]] constexpr bool contains(const Keys& keys, const K& key) const noexcept
+        {
+            if (direct)
+            {
+                const auto offset = offset_of(key);
+
+                return offset < capacity && is_present(offset);
+            }
+
+            return find(keys, key) != N;
+        }
+
+        /// @private whether keys are in the narrow range, so that the table is used (used by the backend::automatic)
+        [[nodiscard]] constexpr bool uses_table() const noexcept
+        {
+            return direct;
+        }
+
+        /// @private prefetches the word of the presence bitmap and the position of the key (used by the batch lookups)
+        template <typename Keys>
+        void prefetch([[maybe_unused]] const Keys& keys, const K& key) const noexcept
+        {
+            const auto offset = offset_of(key);
+
+            if (direct && offset < capacity)
+            {
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+                detail::prefetch(&present[offset / word_bits]);
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+                detail::prefetch(&positions[offset]);
+            }
+        }
+
+    protected:
+        /// @private number of bits in one word of the presence bitmap
+        static constexpr std::size_t word_bits = 64;
+        /// @private number of slots in the table without the limit, multiple of the word_bits
+        static constexpr std::size_t unlimited_capacity = (N * 4 < word_bits ? word_bits : (N * 4 + word_bits - 1) / word_bits * word_bits);
+        /// @private number of slots in the table, multiple of the word_bits
+        static constexpr std::size_t capacity = unlimited_capacity < CapacityLimit ? unlimited_capacity : CapacityLimit;
+
+        static_assert(capacity % word_bits == 0, "Capacity of the dense table should be a multiple of 64");
+
+        /// @private value of the key usable for ordering
+        [[nodiscard]] static constexpr auto underlying(K key) noexcept
+        {
+            if constexpr (std::is_enum_v<K>)
+            {
+                return static_cast<std::underlying_type_t<K>>(key);
+            }
+            else
+            {
+                return key;
+            }
+        }
+
+        /// @private distance of the key from the smallest one; keys below the smallest wrap around to big numbers
+        [[nodiscard]] constexpr std::uint64_t offset_of(K key) const noexcept
+        {
+            using unsigned_type = decltype(detail::to_unsigned(key));
+
+            return static_cast<unsigned_type>(detail::to_unsigned(key) - detail::to_unsigned(smallest));
+        }
+
+        /// @private reads presence bitmap
+        [[nodiscard]] constexpr bool is_present(std::uint64_t offset) const noexcept
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+            return ((present[offset / word_bits] >> (offset % word_bits)) & 1U) != 0;
+        }
+
+    private:
+        K smallest{};
+        bool direct = false;
+        std::array<std::uint64_t, capacity / word_bits> present{};
+        std::array<detail::position_t<N>, capacity> positions{};
+    };
+};
+
+/// @brief Minimal perfect hashing ("hash and displace"), built entirely at compile time in the constructor.
+///        Lookup costs one hash of the key, two table reads and a single key comparison, so it's O(1) regardless of N.
+/// @details Keys are distributed to N buckets by their hash; buckets are then processed from the largest one
+///          and for each a seed is searched for, that places all its keys to free slots
+///          (buckets with a single key are placed directly to any free slot).
+///          Elements are stored in the order of their slots, so the slot is directly the position of an element.
+struct perfect_hash
+{
+    /// @private lookup strategy reported by the hash_map::backend()
+    static constexpr backend_kind kind = backend_kind::perfect_hash;
+
+    /// @private lookup structure of the backend, stores one seed per bucket
+    template <std::size_t N, typename K, typename Hash, typename KeyEqual>
+    class index
+    {
+    public:
+        /// @private seeds computed ahead of time (e.g. by the tools/generate_hash_map.py), see the hash_map(prebuilt_t, ...)
+        using prebuilt_type = std::array<std::uint32_t, N>;
+
+        /// @private index to be built
+        constexpr index() noexcept = default;
+
+        /// @private index with seeds computed ahead of time, keys have to be stored in the order of their slots
+        explicit constexpr index(const prebuilt_type& prebuilt) noexcept
+        : seeds{prebuilt}
+        {
+        }
+
+        /// @private computes seeds for all buckets and the slot of every key;
+        ///          fails the constant evaluation on duplicate keys and on different keys with the same hash (those can't be placed)
+        template <typename Keys>
+        // NOLINTNEXTLINE(readability-function-cognitive-complexity)
+        [[nodiscard]] static CONSTEXPR_HASH_MAP_BUILD detail::build_result<index, N> build(const Keys& keys) noexcept
+        {
+            detail::build_result<index, N> result{};
+            std::array<std::uint64_t, N> hashes{};
+            std::array<std::size_t, N> bucket_sizes{};
+
+            for (std::size_t i = 0; i < N; ++i)
+            {
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+                hashes[i] = Hash{}(keys.key(i));
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+                ++bucket_sizes[bucket_of(hashes[i])];
+            }
+
+            // counting sort of keys by their bucket, so that every bucket's keys are next to each other
+            std::array<std::size_t, N + 1> bucket_starts{};
+            std::size_t largest_bucket = 0;
+
+            for (std::size_t bucket = 0; bucket < N; ++bucket)
+            {
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+                bucket_starts[bucket + 1] = bucket_starts[bucket] + bucket_sizes[bucket];
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+                largest_bucket = bucket_sizes[bucket] > largest_bucket ? bucket_sizes[bucket] : largest_bucket;
+            }
+
+            std::array<std::size_t, N> members{};
+            std::array<std::size_t, N> filled{};
+
+            for (std::size_t i = 0; i < N; ++i)
+            {
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+                const auto bucket = bucket_of(hashes[i]);
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+                members[bucket_starts[bucket] + filled[bucket]++] = i;
+            }
+
+            // keys with the same hash are in the same bucket
+            for (std::size_t bucket = 0; bucket < N; ++bucket)
+            {
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+                for (auto i = bucket_starts[bucket]; i < bucket_starts[bucket + 1]; ++i)
+                {
+                    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+                    for (auto j = i + 1; j < bucket_starts[bucket + 1]; ++j)
+                    {
+                        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+                        if (KeyEqual{}(keys.key(members[i]), keys.key(members[j])))
+                        {
+                            detail::duplicate_keys_are_not_allowed();
+                        }
+                        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+                        else if (hashes[members[i]] == hashes[members[j]])
+                        {
+                            detail::different_keys_with_the_same_hash_are_not_supported();
+                        }
+                    }
+                }
+            }
+
+            std::array<bool, N> taken{};
+            std::array<std::size_t, N> candidates{};
+
+            for (std::size_t size = largest_bucket; size > 1; --size)
+            {
+                for (std::size_t bucket = 0; bucket < N; ++bucket)
+                {
+                    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+                    if (bucket_sizes[bucket] != size)
+                    {
+                        continue;
+                    }
+
+                    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+                    const auto first = bucket_starts[bucket];
+                    bool bucket_placed = false;
+
+                    for (std::uint32_t seed = 1; seed < direct_flag && !bucket_placed; ++seed)
+                    {
+                        std::size_t placed = 0;
+
+                        for (; placed < size; ++placed)
+                        {
+                            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+                            const auto slot = displace(hashes[members[first + placed]], seed);
+                            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+                            bool collides = taken[slot];
+
+                            for (std::size_t previous = 0; previous < placed && !collides; ++previous)
+                            {
+                                // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+                                collides = candidates[previous] == slot;
+                            }
+
+                            if (collides)
+                            {
+                                break;
+                            }
+
+                            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+                            candidates[placed] = slot;
+                        }
+
+                        if (placed == size)
+                        {
+                            for (std::size_t member = 0; member < size; ++member)
+                            {
+                                // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+                                taken[candidates[member]] = true;
+                                // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+                                result.order[candidates[member]] = members[first + member];
+                            }
+
+                            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+                            result.index.seeds[bucket] = seed;
+                            bucket_placed = true;
+                        }
+                    }
+
+                    if (!bucket_placed)
+                    {
+                        // keys of the bucket would be unfindable
+                        detail::no_seed_places_keys_of_the_bucket();
+                    }
+                }
+            }
+
+            std::size_t free_slot = 0;
+
+            for (std::size_t bucket = 0; bucket < N; ++bucket)
+            {
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+                if (bucket_sizes[bucket] == 1)
+                {
+                    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+                    while (taken[free_slot])
+                    {
+                        ++free_slot;
+                    }
+
+                    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+                    taken[free_slot] = true;
+                    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+                    result.order[free_slot] = members[bucket_starts[bucket]];
+                    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+                    result.index.seeds[bucket] = direct_flag | static_cast<std::uint32_t>(free_slot);
+                }
+            }
+
+            return result;
+        }
+
+        /// @private returns position of the key, N if not found
+        template <typename Keys, typename Query>
+        [[nodiscard]] constexpr std::size_t find(const Keys& keys, const Query& key) const noexcept
+        {
+            const auto slot = slot_of(Hash{}(key));
+
+            return KeyEqual{}(keys.key(slot), key) ? slot : N;
+        }
+
+        /// @private checks that every key is stored in its slot (which also means that keys are unique), used for prebuilt seeds
+        template <typename Keys>
+        [[nodiscard]] constexpr bool places(const Keys& keys) const noexcept
+        {
+            for (std::size_t i = 0; i < N; ++i)
+            {
+                if (slot_of(Hash{}(keys.key(i))) != i)
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        /// @private prefetches the seed of the key's bucket (used by the batch lookups, the slot can't be known before the seed is read)
+        template <typename Keys, typename Query>
+        void prefetch([[maybe_unused]] const Keys& keys, const Query& key) const noexcept
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+            detail::prefetch(&seeds[bucket_of(Hash{}(key))]);
+        }
+
+    protected:
+        /// @private marks seeds that directly contain the slot (used for buckets with a single key)
+        static constexpr std::uint32_t direct_flag = detail::perfect_hash_direct_flag;
+
+        /// @private bucket number of a hash
+        [[nodiscard]] static constexpr std::size_t bucket_of(std::uint64_t hash) noexcept
+        {
+            return detail::perfect_hash_bucket(hash, N);
+        }
+
+        /// @private slot of a hash within the bucket using given seed
+        [[nodiscard]] static constexpr std::size_t displace(std::uint64_t hash, std::uint32_t seed) noexcept
+        {
+            return detail::perfect_hash_displace(hash, seed, N);
+        }
+
+        /// @private slot that the key with given hash would occupy
+        [[nodiscard]] constexpr std::size_t slot_of(std::uint64_t hash) const noexcept
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+            return detail::perfect_hash_slot(hash, seeds[bucket_of(hash)], N);
+        }
+
+    private:
+        std::array<std::uint32_t, N> seeds{};
+    };
+};
+
+/// @brief Elements are sorted by keys at compile time in the constructor, lookup is a branchless binary search
+///        (O(log N) comparisons, the number of iterations depends only on N). Keys need only to be ordered, Hash is not used.
+/// @details Elements are stored (and iterated) in the ascending order of keys, which enables the lower_bound, upper_bound and equal_range.
+///          Keys are equal, when neither is less than the other, KeyEqual is not used.
+/// @tparam Compare constexpr and default constructible function object ordering keys, ct::less<K> if void
+template <typename Compare = void>
+struct sorted
+{
+    /// @private lookup strategy reported by the hash_map::backend()
+    static constexpr backend_kind kind = backend_kind::sorted;
+
+    /// @private lookup structure of the backend, elements themselves are the sorted array, so there's nothing else to store
+    template <std::size_t N, typename K, typename Hash, typename KeyEqual>
+    class index
+    {
+        using compare_type = std::conditional_t<std::is_void_v<Compare>, less<K>, Compare>;
+
+    public:
+        /// @private elements are stored in the order of keys
+        static constexpr bool ordered = true;
+
+        /// @private sorts entries by their keys, fails the constant evaluation on duplicate keys
+        template <typename Keys>
+        [[nodiscard]] static CONSTEXPR_HASH_MAP_BUILD detail::build_result<index, N> build(const Keys& keys) noexcept
+        {
+            detail::build_result<index, N> result{};
+
+            for (std::size_t i = 0; i < N; ++i)
+            {
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+                result.order[i] = i;
+            }
+
+            detail::heap_sort(result.order, [&keys](std::size_t lhs, std::size_t rhs) { return compare_type{}(keys.key(lhs), keys.key(rhs)); });
+
+            // equal keys end up next to each other
+            for (std::size_t i = 1; i < N; ++i)
+            {
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+                if (!compare_type{}(keys.key(result.order[i - 1]), keys.key(result.order[i])))
+                {
+                    detail::duplicate_keys_are_not_allowed();
+                }
+            }
+
+            return result;
+        }
+
+        /// @private returns position of the key, N if not found
+        template <typename Keys, typename Query>
+        [[nodiscard]] constexpr std::size_t find(const Keys& keys, const Query& key) const noexcept
+        {
+            const auto position = lower_bound(keys, key);
+
+            return position != N && !compare_type{}(key, keys.key(position)) ? position : N;
+        }
+
+        /// @private position of the first key that is not less than the given one, N if there's none
+        /// @details The range is halved in every iteration by a conditional move instead of a branch
+        template <typename Keys, typename Query>
+        [[nodiscard]] constexpr std::size_t lower_bound(const Keys& keys, const Query& key) const noexcept
+        {
+            std::size_t first = 0;
+
+            for (std::size_t length = N; length > 1;)
+            {
+                const auto half = length / 2;
+                first = compare_type{}(keys.key(first + half), key) ? first + half : first;
+                length -= half;
+            }
+
+            return first + static_cast<std::size_t>(compare_type{}(keys.key(first), key));
+        }
+
+        /// @private positions of the first key not less than the given one and of the first key greater than the given one
+        template <typename Keys, typename Query>
+        [[nodiscard]] constexpr std::pair<std::size_t, std::size_t> equal_range(const Keys& keys, const Query& key) const noexcept
+        {
+            const auto first = lower_bound(keys, key);
+
+            return {first, first + static_cast<std::size_t>(first != N && !compare_type{}(key, keys.key(first)))};
+        }
+    };
+};
+
+/// @brief Same as the backend::sorted, but the binary search walks a copy of keys stored in the Eytzinger (breadth-first) order
+///        of an implicit binary search tree, so that levels of the tree visited first share cache lines
+///        and descendants several levels down are prefetched at runtime.
+/// @details Needs default constructible keys and keeps a copy of them (and one position per key); elements themselves are still
+///          stored (and iterated) in the ascending order of keys and lower_bound, upper_bound and equal_range are available.
+/// @tparam Compare constexpr and default constructible function object ordering keys, ct::less<K> if void
+template <typename Compare = void>
+struct eytzinger
+{
+    /// @private lookup strategy reported by the hash_map::backend()
+    static constexpr backend_kind kind = backend_kind::eytzinger;
+
+    /// @private lookup structure of the backend: the tree of keys and positions of its nodes in the sorted array
+    template <std::size_t N, typename K, typename Hash, typename KeyEqual>
+    class index
+    {
+        using compare_type = std::conditional_t<std::is_void_v<Compare>, less<K>, Compare>;
+
+    public:
+        /// @private elements are stored in the order of keys
+        static constexpr bool ordered = true;
+
+        /// @private sorts entries by their keys (the same way as the backend::sorted) and lays the sorted keys out to the tree
+        template <typename Keys>
+        [[nodiscard]] static CONSTEXPR_HASH_MAP_BUILD detail::build_result<index, N> build(const Keys& keys) noexcept
+        {
+            detail::build_result<index, N> result{};
+            result.order = sorted<Compare>::template index<N, K, Hash, KeyEqual>::build(keys).order;
+
+            // in-order walk of the tree (children of the node "i" are "2 * i" and "2 * i + 1") visits nodes in the ascending order
+            std::size_t node = leftmost(1);
+
+            for (std::size_t rank = 0; rank < N; ++rank)
+            {
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+                result.index.tree[node] = keys.key(result.order[rank]);
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+                result.index.ranks[node] = static_cast<detail::position_t<N>>(rank);
+
+                if (2 * node + 1 <= N)
+                {
+                    node = leftmost(2 * node + 1);
+                }
+                else
+                {
+                    // climbs while coming from the right child, then once more to the parent
+                    while ((node & 1U) != 0)
+                    {
+                        node >>= 1U;
+                    }
+
+                    node >>= 1U;
+                }
+            }
+
+            return result;
+        }
+
+        /// @private returns position of the key, N if not found
+        template <typename Keys, typename Query>
+        [[nodiscard]] constexpr std::size_t find([[maybe_unused]] const Keys& keys, const Query& key) const noexcept
+        {
+            const auto node = node_of(key);
+
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+            return node != 0 && !compare_type{}(key, tree[node]) ? ranks[node] : N;
+        }
+
+        /// @private position of the first key that is not less than the given one, N if there's none
+        template <typename Keys, typename Query>
+        [[nodiscard]] constexpr std::size_t lower_bound([[maybe_unused]] const Keys& keys, const Query& key) const noexcept
+        {
+            const auto node = node_of(key);
+
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+            return node != 0 ? ranks[node] : N;
+        }
+
+        /// @private positions of the first key not less than the given one and of the first key greater than the given one
+        template <typename Keys, typename Query>
+        [[nodiscard]] constexpr std::pair<std::size_t, std::size_t> equal_range([[maybe_unused]] const Keys& keys, const Query& key) const noexcept
+        {
+            const auto node = node_of(key);
+
+            if (node == 0)
+            {
+                return {N, N};
+            }
+
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+            return {ranks[node], ranks[node] + static_cast<std::size_t>(!compare_type{}(key, tree[node]))};
+        }
+
+    protected:
+        /// @private descendants of the node "i" starting at "i * prefetch_stride" take roughly one cache line, they are prefetched
+        static constexpr std::size_t prefetch_stride = sizeof(K) <= 4 ? 16 : (sizeof(K) <= 8 ? 8 : 4);
+
+        /// @private the leftmost (smallest) node of the subtree
+        [[nodiscard]] static constexpr std::size_t leftmost(std::size_t node) noexcept
+        {
+            while (2 * node <= N)
+            {
+                node *= 2;
+            }
+
+            return node;
+        }
+
+        /// @private node with the first key that is not less than the given one, 0 if there's none
+        /// @details Descends the whole tree going right whenever the node's key is less (without branching on the result),
+        ///          the path then ends with ones followed by a zero, that are stripped to get back to the node where it went left
+        template <typename Query>
+        [[nodiscard]] constexpr std::size_t node_of(const Query& key) const noexcept
+        {
+            std::size_t node = 1;
+
+            while (node <= N)
+            {
+                if (!detail::is_constant_evaluated())
+                {
+                    const auto descendant = node * prefetch_stride;
+                    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+                    detail::prefetch(&tree[descendant <= N ? descendant : N]);
+                }
+
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+                node = 2 * node + static_cast<std::size_t>(compare_type{}(tree[node], key));
+            }
+
+            if (detail::is_constant_evaluated())
+            {
+                while ((node & 1U) != 0)
+                {
+                    node >>= 1U;
+                }
+
+                return node >> 1U;
+            }
+
+            return node >> (detail::count_trailing_zeros(~static_cast<std::uint64_t>(node)) + 1);
+        }
+
+    private:
+        // node 0 is unused, so that children of the node "i" are "2 * i" and "2 * i + 1"
+        std::array<K, N + 1> tree{};
+        std::array<detail::position_t<N>, N + 1> ranks{};
+    };
+};
+
+/// @brief Default backend of the ct::hash_map, chooses one of the other backends at compile time from N, K and the keys themselves:
+///        * integral and enumeration keys (compared by the default ct::equal_to) in a narrow range -- backend::dense
+///        * few keys -- backend::linear (at most 64 keys of 32 bits, which are scanned by vector instructions, or 8 other keys)
+///        * keys that might be hashed -- backend::perfect_hash (regardless of N, tables too big for the compiler's constexpr limits
+///          might be generated by the tools/generate_hash_map.py)
+///        * the rest -- backend::linear
+/// @details Chosen strategy is reported by the hash_map::backend(). Integral keys carry the table of the backend::dense
+///          even if it isn't used, as keys are known only when the map is constructed, so the table is limited to 1024 slots
+///          (at most 2 KiB of positions and 128 B of the presence bitmap) and wider ranges of keys aren't looked up by it;
+///          other keys carry just the chosen backend.
+///          Elements are stored in the order of the chosen backend (in the order of slots for the backend::perfect_hash).
+struct automatic
+{
+    /// @private lookup structure of the backend, holds the index of the chosen backend (and the dense table for integral keys)
+    template <std::size_t N, typename K, typename Hash, typename KeyEqual>
+    class index
+    {
+        static constexpr bool integral = (std::is_integral_v<K> || std::is_enum_v<K>) && std::is_same_v<detail::uninstrumented_t<KeyEqual>, equal_to<K>>;
+        static constexpr bool hashable = detail::is_hashable<Hash, K>::value;
+        static constexpr std::size_t scan_limit = integral && sizeof(K) == sizeof(std::uint32_t) ? detail::simd::word_scan_limit : 8;
+        static constexpr std::size_t table_limit = 1024;
+
+        /// @private placeholder of the dense table for keys that aren't integral
+        struct no_table
+        {
+        };
+
+        using table_type = std::conditional_t<integral, dense::index<N, K, Hash, KeyEqual, table_limit>, linear::index<N, K, Hash, KeyEqual>>;
+        using fallback_backend = std::conditional_t<N <= scan_limit || !hashable, linear, perfect_hash>;
+        using fallback_type = typename fallback_backend::template index<N, K, Hash, KeyEqual>;
+
+    public:
+        /// @private builds the dense table for integral keys and the chosen backend if the table can't be used;
+        ///          fails the constant evaluation on duplicate keys
+        template <typename Keys>
+        [[nodiscard]] static CONSTEXPR_HASH_MAP_BUILD detail::build_result<index, N> build(const Keys& keys) noexcept
+        {
+            detail::build_result<index, N> result{};
+
+            if constexpr (integral)
+            {
+                const auto table = table_type::build(keys);
+
+                if (table.index.uses_table())
+                {
+                    result.index.table = table.index;
+                    result.index.chosen = backend_kind::dense;
+                    result.order = table.order;
+
+                    return result;
+                }
+            }
+
+            const auto fallback = fallback_type::build(keys);
+            result.index.fallback = fallback.index;
+            result.index.chosen = fallback_backend::kind;
+            result.order = fallback.order;
+
+            return result;
+        }
+
+        /// @private returns position of the key, N if not found
+        template <typename Keys, typename Query>
+        [[nodiscard]] constexpr std::size_t find(const Keys& keys, const Query& key) const noexcept
+        {
+            if constexpr (integral)
+            {
+                if (chosen == backend_kind::dense)
+                {
+                    return table.find(keys, key);
+                }
+            }
+
+            return fallback.find(keys, key);
+        }
+
+        /// @private checks existence of the key, using the presence bitmap if the dense table is used
+        template <typename Keys, typename Query>
+        [[nodiscard]] constexpr bool contains(const Keys& keys, const Query& key) const noexcept
+        {
+            if constexpr (integral)
+            {
+                if (chosen == backend_kind::dense)
+                {
+                    return table.contains(keys, key);
+                }
+            }
+
+            return fallback.find(keys, key) != N;
+        }
+
+        /// @private prefetches what the chosen backend needs (used by the batch lookups)
+        template <typename Keys, typename Query>
+        void prefetch(const Keys& keys, const Query& key) const noexcept
+        {
+            if constexpr (integral)
+            {
+                if (chosen == backend_kind::dense)
+                {
+                    table.prefetch(keys, key);
+
+                    return;
+                }
+            }
+
+            if constexpr (detail::has_prefetch<fallback_type, Keys, Query>::value)
+            {
+                fallback.prefetch(keys, key);
+            }
+        }
+
+        /// @private lookup strategy chosen in the build
+        [[nodiscard]] constexpr backend_kind kind() const noexcept
+        {
+            return chosen;
+        }
+
+    private:
+        std::conditional_t<integral, table_type, no_table> table{};
+        fallback_type fallback{};
+        backend_kind chosen = fallback_backend::kind;
+    };
+};
+}  // namespace backend
+
+/// @private implementation details, not part of the public interface
+namespace detail
+{
+/// @private detects indices that choose their strategy only when they're built (backend::automatic)
+template <typename Index, typename = void>
+struct has_kind : std::false_type {};
+
+/// @private detects indices that choose their strategy only when they're built (backend::automatic)
+template <typename Index>
+struct has_kind<Index, std::void_t<decltype(std::declval<const Index&>().kind())>> : std::true_type {};
+
+/// @private detects backends that report their strategy
+template <typename Backend, typename = void>
+struct has_static_kind : std::false_type {};
+
+/// @private detects backends that report their strategy
+template <typename Backend>
+struct has_static_kind<Backend, std::void_t<decltype(Backend::kind)>> : std::true_type {};
+
+/// @private stands for the prebuilt data of indices that can't be built ahead of time
+struct not_prebuilt
+{
+};
+
+/// @private data from which the index might be constructed instead of being built (e.g. seeds of the backend::perfect_hash)
+template <typename Index, typename = void>
+struct prebuilt
+{
+    /// @private indices that can't be built ahead of time
+    using type = not_prebuilt;
+};
+
+/// @private data from which the index might be constructed instead of being built (e.g. seeds of the backend::perfect_hash)
+template <typename Index>
+struct prebuilt<Index, std::void_t<typename Index::prebuilt_type>>
+{
+    /// @private data given by the index
+    using type = typename Index::prebuilt_type;
+};
+
+/// @private positions 0 ... N - 1, elements are stored as they are
+template <std::size_t N>
+[[nodiscard]] constexpr std::array<std::size_t, N> identity_order() noexcept
+{
+    std::array<std::size_t, N> result{};
+
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+        result[i] = i;
+    }
+
+    return result;
+}
+
+/// @private deliberately not constexpr, so that reaching it in constant evaluation makes the compilation fail
+inline void prebuilt_index_does_not_match_keys() noexcept
+{
+}
+}  // namespace detail
+
+/// @brief Tag that selects the constructor of the ct::hash_map taking an index computed ahead of time.
+struct prebuilt_t
+{
+    /// @brief the tag has to be named explicitly
+    explicit prebuilt_t() = default;
+};
+
+/// @brief Selects the constructor of the ct::hash_map taking an index computed ahead of time, see tools/generate_hash_map.py.
+inline constexpr prebuilt_t prebuilt{};
+
+/// @brief Memory layouts that might be passed as the Layout template argument of the ct::hash_map.
+namespace layout
+{
+/// @brief Array of std::pair<K, V>, keys are interleaved with values.
+///        Iterators are the ones of the std::array, so elements are real pairs.
+struct aos
+{
+    /// @private container for the elements
+    template <std::size_t N, typename K, typename V>
+    class storage
+    {
+    public:
+        /// @private form in which the elements are passed to the constructor
+        using data_type = std::array<std::pair<K, V>, N>;
+        /// @private iterator of the underlying std::array
+        using const_iterator = typename data_type::const_iterator;
+
+        /// @private stores elements in given order
+        constexpr storage(const data_type& elements, const std::array<std::size_t, N>& order) noexcept
+        : storage{elements, order, std::make_index_sequence<N>{}}
+        {
+        }
+
+        /// @private key of i-th element
+        [[nodiscard]] constexpr const K& key(std::size_t i) const noexcept
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+            return data[i].first;
+        }
+
+        /// @private value of i-th element
+        [[nodiscard]] constexpr const V& value(std::size_t i) const noexcept
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+            return data[i].second;
+        }
+
+        /// @private iterator to the first element
+        [[nodiscard]] constexpr const_iterator begin() const noexcept
+        {
+            return std::cbegin(data);
+        }
+
+        /// @private iterator past the last element
+        [[nodiscard]] constexpr const_iterator end() const noexcept
+        {
+            return std::cend(data);
+        }
+
+    private:
+        template <std::size_t... I>
+        constexpr storage(const data_type& elements, const std::array<std::size_t, N>& order, std::index_sequence<I...>) noexcept
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+        : data{elements[order[I]]...}
+        {
+        }
+
+        data_type data;
+    };
+};
+
+/// @brief Keys and values are stored in two separate arrays ("structure of arrays"),
+///        so lookups that have to compare keys touch only the array of keys.
+///        Iterators give std::pair<const K&, const V&> that is created on the fly.
+struct soa
+{
+    /// @private container for the elements
+    template <std::size_t N, typename K, typename V>
+    class storage
+    {
+    public:
+        /// @private form in which the elements are passed to the constructor
+        using data_type = std::array<std::pair<K, V>, N>;
+        /// @private iterator that gives pairs of references
+        using const_iterator = detail::proxy_iterator<storage>;
+
+        /// @private stores elements in given order
+        constexpr storage(const data_type& elements, const std::array<std::size_t, N>& order) noexcept
+        : storage{elements, order, std::make_index_sequence<N>{}}
+        {
+        }
+
+        /// @private key of i-th element
+        [[nodiscard]] constexpr const K& key(std::size_t i) const noexcept
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+            return keys[i];
+        }
+
+        /// @private value of i-th element
+        [[nodiscard]] constexpr const V& value(std::size_t i) const noexcept
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+            return values[i];
+        }
+
+        /// @private iterator to the first element
+        [[nodiscard]] constexpr const_iterator begin() const noexcept
+        {
+            return {*this, 0};
+        }
+
+        /// @private iterator past the last element
+        [[nodiscard]] constexpr const_iterator end() const noexcept
+        {
+            return {*this, N};
+        }
+
+    private:
+        template <std::size_t... I>
+        constexpr storage(const data_type& elements, const std::array<std::size_t, N>& order, std::index_sequence<I...>) noexcept
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+        : keys{elements[order[I]].first...}, values{elements[order[I]].second...}
+        {
+        }
+
+        std::array<K, N> keys;
+        std::array<V, N> values;
+    };
+};
+
+/// @brief Keys ("const char*" or std::string_view) are copied to one contiguous pool of characters (each one null-terminated)
+///        and addressed by 32-bit offsets, so the map doesn't refer to string literals scattered around the binary,
+///        an entry costs 4 bytes plus its characters and keys are scanned sequentially in memory.
+///        Iterators give std::pair<K, const V&> that is created on the fly.
+/// @details Sizes of the pools are given explicitly, as they have to be known before the constructor runs;
+///          they might be computed by the pooled_key_bytes and pooled_value_bytes. If strings don't fit,
+///          the constant evaluation fails in the detail::pooled_strings<...>::string_pool_is_too_small().
+/// @tparam KeyBytes size of the pool for keys, total length of all keys plus one (for the null character) per key
+/// @tparam ValueBytes size of the pool for values ("const char*" or std::string_view) the same way as for keys;
+///         if 0, values are not pooled and are stored in an array; otherwise values are both stored and returned by value
+template <std::size_t KeyBytes, std::size_t ValueBytes = 0>
+struct string_pool
+{
+    /// @private container for the elements
+    template <std::size_t N, typename K, typename V>
+    class storage
+    {
+        static_assert(detail::is_string_v<K>, "String pool needs \"const char*\" or std::string_view keys");
+        static_assert(ValueBytes == 0 || detail::is_string_v<V>, "Values might be pooled only if they are \"const char*\" or std::string_view");
+
+        static constexpr bool pools_values = ValueBytes > 0;
+
+    public:
+        /// @private form in which the elements are passed to the constructor
+        using data_type = std::array<std::pair<K, V>, N>;
+        /// @private iterator that gives pairs of the key and the value
+        using const_iterator = detail::proxy_iterator<storage>;
+
+        /// @private copies keys (and values, if pooled) to the pools in given order
+        constexpr storage(const data_type& elements, const std::array<std::size_t, N>& order) noexcept
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+        : keys{detail::pooled_strings<N, KeyBytes>::pack([&](std::size_t i) { return elements[order[i]].first; })},
+          values{make_values(elements, order, std::make_index_sequence<N>{})}
+        {
+        }
+
+        /// @private key of i-th element
+        [[nodiscard]] constexpr K key(std::size_t i) const noexcept
+        {
+            return keys.template get<K>(i);
+        }
+
+        /// @private value of i-th element, by value if values are pooled
+        [[nodiscard]] constexpr decltype(auto) value(std::size_t i) const noexcept
+        {
+            if constexpr (pools_values)
+            {
+                return values.template get<V>(i);
+            }
+            else
+            {
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+                return values[i];
+            }
+        }
+
+        /// @private iterator to the first element
+        [[nodiscard]] constexpr const_iterator begin() const noexcept
+        {
+            return {*this, 0};
+        }
+
+        /// @private iterator past the last element
+        [[nodiscard]] constexpr const_iterator end() const noexcept
+        {
+            return {*this, N};
+        }
+
+    private:
+        using values_type = std::conditional_t<pools_values, detail::pooled_strings<N, ValueBytes>, std::array<V, N>>;
+
+        template <std::size_t... I>
+        [[nodiscard]] static constexpr values_type make_values(const data_type& elements, const std::array<std::size_t, N>& order, std::index_sequence<I...>) noexcept
+        {
+            if constexpr (pools_values)
+            {
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+                return values_type::pack([&](std::size_t i) { return elements[order[i]].second; });
+            }
+            else
+            {
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+                return values_type{elements[order[I]].second...};
+            }
+        }
+
+        detail::pooled_strings<N, KeyBytes> keys;
+        values_type values;
+    };
+};
+
+/// @brief Size of the layout::string_pool needed for keys of given elements.
+/// @param elements elements, that the map will be constructed from
+/// @return total length of all keys plus one (for the null character) per key
+template <std::size_t N, typename K, typename V>
+[[nodiscard]] constexpr std::size_t pooled_key_bytes(const std::array<std::pair<K, V>, N>& elements) noexcept
+{
+    std::size_t bytes = 0;
+
+    for (const auto& element : elements)
+    {
+        bytes += std::string_view{element.first}.size() + 1;
+    }
+
+    return bytes;
+}
+
+/// @brief Size of the layout::string_pool needed for values of given elements.
+/// @param elements elements, that the map will be constructed from
+/// @return total length of all values plus one (for the null character) per value
+template <std::size_t N, typename K, typename V>
+[[nodiscard]] constexpr std::size_t pooled_value_bytes(const std::array<std::pair<K, V>, N>& elements) noexcept
+{
+    std::size_t bytes = 0;
+
+    for (const auto& element : elements)
+    {
+        bytes += std::string_view{element.second}.size() + 1;
+    }
+
+    return bytes;
+}
+}  // namespace layout
+
+/// @brief Policies of the hash_map observing its lookups at runtime, lookups in constexpr context are never observed.
+/// @details Policy has the "enabled" constant; enabled policy also gives the KeyEqual passed to the backend (alias template "key_equal"),
+///          its start() is called before every runtime lookup and record(found) after it, see instrumentation::counting in the instrumentation.hpp.
+namespace instrumentation
+{
+/// @brief Lookups aren't observed, the default; nothing is compiled in, so there's no cost.
+struct none
+{
+    /// @private lookups aren't observed
+    static constexpr bool enabled = false;
+
+    /// @private backend gets the KeyEqual as it is
+    template <typename KeyEqual>
+    using key_equal = KeyEqual;
+};
+}  // namespace instrumentation
+
 /// @brief Compile-time hash-map (associative key-value container) that performs all operations in constexpr context.
 ///        This means that keys and values have to be constexpr and noexcept constructible and provide constexpr noexcept operator=.
-/// @brief Behaviour is undefined, if there are multiple same keys.
-/// @brief There's actually no hash function needed, see details section.
-/// @details Implemented as an std::array containing pairs, so no hashing is involved.
+/// @brief Multiple same keys are a compile error, if the map is constant-initialized (e.g. "static constexpr");
+///        every backend checks keys while building its index in the constructor, lookups are not affected.
+/// @brief By default there's actually no hash function needed, see details section.
+/// @details By default implemented as an std::array containing pairs (see the Layout); lookup strategy is given by the Backend,
+///          by default it's chosen from N, K and the keys by the backend::automatic (a linear scan for few keys, so no hashing is involved).
 /// @tparam N total number of elements
 /// @tparam K data type for keys
 /// @tparam V data type for values
-template <std::size_t N, typename K, typename V>
+/// @tparam Hash constexpr and default constructible function object giving std::uint64_t hashes of keys
+///         (not used by the backend::linear and the backend::dense), see ct::hash
+/// @tparam KeyEqual constexpr and default constructible function object comparing keys, see ct::equal_to
+/// @tparam Backend lookup strategy, one of the types from the burda::ct::backend namespace;
+///         by default backend::automatic, which chooses one of the others (see hash_map::backend())
+/// @tparam Layout memory layout of keys and values, one of the types from the burda::ct::layout namespace
+/// @tparam Instrumentation policy observing runtime lookups, one of the types from the burda::ct::instrumentation namespace;
+///         by default instrumentation::none, that costs nothing
+template <std::size_t N, typename K, typename V, typename Hash = hash<K>, typename KeyEqual = equal_to<K>,
+          typename Backend = backend::automatic, typename Layout = layout::aos, typename Instrumentation = instrumentation::none>
 class hash_map
 {
 public:
@@ -26,20 +2439,59 @@ public:
     using value_type = V;
     /// @see std::unordered_map<...>::size_type
     using size_type = decltype(N);
-    /// @brief underlying structure used for the actual implementation
+    /// @brief structure in which elements are passed to the constructor (and stored, unless the Layout says otherwise)
     using data_type = std::array<std::pair<K, V>, N>;
     /// @see std::array<...>::const_iterator
-    using const_iterator = typename data_type::const_iterator;
+    using const_iterator = typename Layout::template storage<N, K, V>::const_iterator;
+    /// @see std::unordered_map<...>::hasher
+    using hasher = Hash;
+    /// @see std::unordered_map<...>::key_equal
+    using key_equal = KeyEqual;
+    /// @brief lookup strategy
+    using backend_type = Backend;
+    /// @brief memory layout
+    using layout_type = Layout;
+    /// @brief policy observing runtime lookups
+    using instrumentation_type = Instrumentation;
+    /// @brief type through which values are accessed, const V& (V for the layout::string_pool with pooled values)
+    using value_reference = decltype(std::declval<const typename Layout::template storage<N, K, V>&>().value(0));
 
-    /// @brief The only construction that might be used, all keys and values must be provided in the constructor.
+    /// @brief Construction from all the elements passed directly, all keys and values must be provided in the constructor.
+    /// @tparam E type of the first element, automatically deduced by the compiler
     /// @tparam R variadic arguments automatically deduced by the compiler
-    /// @param elements series of std::pair<K, V>, cannot be empty
-    template<typename... E>
-    explicit constexpr hash_map(E&&... elements) noexcept
-    : data{std::forward<E>(elements)...}
+    /// @param first first std::pair<K, V>
+    /// @param elements rest of the std::pair<K, V> elements
+    /// @details Only the first argument is constrained, checking the whole pack is expensive to compile for big N.
+    template<typename E, typename... R, std::enable_if_t<std::is_constructible_v<std::pair<K, V>, E&&>, int> = 0>
+    explicit CONSTEXPR_HASH_MAP_BUILD hash_map(E&& first, R&&... elements) noexcept
+    : hash_map{detail::build_tag{}, data_type{std::forward<E>(first), std::forward<R>(elements)...}}
+    {
+        static_assert(N > 0, "N should be positive");
+        static_assert(N == 1 + sizeof...(elements), "Elements size doesn't match expected size of a hash-map");
+    }
+
+    /// @brief Construction from all the elements gathered in an array, e.g. computed by a constexpr function.
+    /// @param elements all N std::pair<K, V> elements
+    /// @see make_hash_map, invert
+    explicit CONSTEXPR_HASH_MAP_BUILD hash_map(const data_type& elements) noexcept
+    : hash_map{detail::build_tag{}, elements}
     {
         static_assert(N > 0, "N should be positive");
-        static_assert(N == sizeof...(elements), "Elements size doesn't match expected size of a hash-map");
+    }
+
+    /// @brief Construction from elements and an index computed ahead of time (e.g. by the tools/generate_hash_map.py),
+    ///        so that the compiler doesn't build the index; available for the backend::perfect_hash (prebuilt data are its seeds).
+    ///        Elements have to be in the order the index expects (order of slots), which is checked in O(N) in constant evaluation.
+    /// @param elements all N std::pair<K, V> elements in the order of the index
+    /// @param prebuilt_index data of the index
+    explicit CONSTEXPR_HASH_MAP_BUILD hash_map(prebuilt_t /*tag*/, const data_type& elements,
+                                               const typename detail::prebuilt<typename Backend::template index<N, K, Hash, typename Instrumentation::template key_equal<KeyEqual>>>::type& prebuilt_index) noexcept
+    : index{prebuilt_index}, data{elements, detail::identity_order<N>()}
+    {
+        if (!index.places(data))
+        {
+            detail::prebuilt_index_does_not_match_keys();
+        }
     }
 
     /// @brief Searches map for a given key and returns iterator.
@@ -47,7 +2499,7 @@ public:
     /// @return constant iterator to an element (cend, if not found)
     [[nodiscard]] constexpr const_iterator find(const K& key) const noexcept
     {
-        return search<0, N>(key);
+        return std::next(cbegin(), search(key));
     }
 
     /// @brief Searches for a given key, aimed to return associated value with it.
@@ -55,7 +2507,7 @@ public:
     /// @return pair, where first denotes whether element was found, second given value
     /// @details Deliberately not throwing an exception, and returning pair instead,
     ///          as this generates much shorter assembly on clang and msvc
-    [[nodiscard]] constexpr std::pair<bool, const V&> at(const K& key) const noexcept
+    [[nodiscard]] constexpr std::pair<bool, value_reference> at(const K& key) const noexcept
     {
         const auto it = find(key);
 
@@ -68,11 +2520,12 @@ public:
     }
 
     /// @brief Retrieves reference to constant to a value.
-    ///        Doesn't perform any bounds checking, behaviour is undefined if the key doesn't exist.
+    ///        Doesn't perform any bounds checking, behaviour is undefined if the key doesn't exist
+    ///        (see the ct::get for keys known at compile time, that are checked).
     /// @param key key to be searched for
-    /// @return reference to constant to a value associated with the key
+    /// @return reference to constant to a value associated with the key (see value_reference)
     // NOLINTNEXTLINE(fuchsia-overloaded-operator)
-    [[nodiscard]] constexpr const V& operator[](const K& key) const noexcept
+    [[nodiscard]] constexpr value_reference operator[](const K& key) const noexcept
     {
         return find(key)->second;
     }
@@ -82,14 +2535,235 @@ public:
     /// @return boolean that denotes key's existence
     [[nodiscard]] constexpr bool contains(const K& key) const noexcept
     {
-        return search<0, N>(key) != cend();
+        return exists(key);
+    }
+
+    /// @brief Gives the first element whose key is not less than the given one;
+    ///        available only for the backends that keep elements ordered (backend::sorted, backend::eytzinger).
+    /// @param key key to be searched for
+    /// @return constant iterator to an element (cend, if all keys are less)
+    /// @see std::map<...>::lower_bound
+    [[nodiscard]] constexpr const_iterator lower_bound(const K& key) const noexcept
+    {
+        static_assert(detail::is_ordered<lookup_type>::value, "lower_bound needs an ordered backend (backend::sorted or backend::eytzinger)");
+
+        return std::next(cbegin(), index.lower_bound(data, key));
+    }
+
+    /// @brief Gives the first element whose key is greater than the given one;
+    ///        available only for the backends that keep elements ordered (backend::sorted, backend::eytzinger).
+    /// @param key key to be searched for
+    /// @return constant iterator to an element (cend, if no key is greater)
+    /// @see std::map<...>::upper_bound
+    [[nodiscard]] constexpr const_iterator upper_bound(const K& key) const noexcept
+    {
+        return equal_range(key).second;
+    }
+
+    /// @brief Gives range of elements with the given key (so either empty or of one element);
+    ///        available only for the backends that keep elements ordered (backend::sorted, backend::eytzinger).
+    /// @param key key to be searched for
+    /// @return pair of the lower_bound and the upper_bound
+    /// @see std::map<...>::equal_range
+    [[nodiscard]] constexpr std::pair<const_iterator, const_iterator> equal_range(const K& key) const noexcept
+    {
+        static_assert(detail::is_ordered<lookup_type>::value, "equal_range needs an ordered backend (backend::sorted or backend::eytzinger)");
+
+        const auto range = index.equal_range(data, key);
+
+        return {std::next(cbegin(), range.first), std::next(cbegin(), range.second)};
+    }
+
+    /// @brief Heterogeneous lower_bound (see the find(const Query&)), Compare of the backend has to order keys and queries.
+    /// @tparam Query type of the query, automatically deduced by the compiler
+    /// @param key query
+    /// @return constant iterator to an element (cend, if all keys are less)
+    template <typename Query, std::enable_if_t<detail::is_heterogeneous_v<Hash, KeyEqual, K, Query>, int> = 0>
+    [[nodiscard]] constexpr const_iterator lower_bound(const Query& key) const noexcept
+    {
+        static_assert(detail::is_ordered<lookup_type>::value, "lower_bound needs an ordered backend (backend::sorted or backend::eytzinger)");
+
+        return std::next(cbegin(), index.lower_bound(data, key));
+    }
+
+    /// @brief Heterogeneous upper_bound (see the find(const Query&)), Compare of the backend has to order keys and queries.
+    /// @tparam Query type of the query, automatically deduced by the compiler
+    /// @param key query
+    /// @return constant iterator to an element (cend, if no key is greater)
+    template <typename Query, std::enable_if_t<detail::is_heterogeneous_v<Hash, KeyEqual, K, Query>, int> = 0>
+    [[nodiscard]] constexpr const_iterator upper_bound(const Query& key) const noexcept
+    {
+        return equal_range(key).second;
+    }
+
+    /// @brief Heterogeneous equal_range (see the find(const Query&)), Compare of the backend has to order keys and queries.
+    /// @tparam Query type of the query, automatically deduced by the compiler
+    /// @param key query
+    /// @return pair of the lower_bound and the upper_bound
+    template <typename Query, std::enable_if_t<detail::is_heterogeneous_v<Hash, KeyEqual, K, Query>, int> = 0>
+    [[nodiscard]] constexpr std::pair<const_iterator, const_iterator> equal_range(const Query& key) const noexcept
+    {
+        static_assert(detail::is_ordered<lookup_type>::value, "equal_range needs an ordered backend (backend::sorted or backend::eytzinger)");
+
+        const auto range = index.equal_range(data, key);
+
+        return {std::next(cbegin(), range.first), std::next(cbegin(), range.second)};
+    }
+
+    /// @brief Searches map for a key equal to the query of another type (heterogeneous lookup), e.g. std::string_view in a map
+    ///        with "const char*" keys, so that the query doesn't have to be converted (and copied, if it isn't null-terminated).
+    ///        Available, if both Hash and KeyEqual have the member type "is_transparent" (as the defaults for "const char*" do).
+    /// @tparam Query type of the query, automatically deduced by the compiler
+    /// @param key query; Hash has to give the same hash as for the equal key and KeyEqual has to compare it with keys
+    /// @return constant iterator to an element (cend, if not found)
+    template <typename Query, std::enable_if_t<detail::is_heterogeneous_v<Hash, KeyEqual, K, Query>, int> = 0>
+    [[nodiscard]] constexpr const_iterator find(const Query& key) const noexcept
+    {
+        return std::next(cbegin(), search(key));
+    }
+
+    /// @brief Searches map for the given characters (heterogeneous lookup, see the find(const Query&)),
+    ///        e.g. a slice of a buffer that is not null-terminated.
+    /// @param characters first of the searched characters
+    /// @param count number of the searched characters
+    /// @return constant iterator to an element (cend, if not found)
+    [[nodiscard]] constexpr const_iterator find(const char* characters, size_type count) const noexcept
+    {
+        return find(std::string_view{characters, count});
+    }
+
+    /// @brief Searches for a key equal to the query of another type (heterogeneous lookup, see the find(const Query&)).
+    /// @tparam Query type of the query, automatically deduced by the compiler
+    /// @param key query
+    /// @return pair, where first denotes whether element was found, second given value
+    template <typename Query, std::enable_if_t<detail::is_heterogeneous_v<Hash, KeyEqual, K, Query>, int> = 0>
+    [[nodiscard]] constexpr std::pair<bool, value_reference> at(const Query& key) const noexcept
+    {
+        const auto it = find(key);
+
+        if (it != cend())
+        {
+            return {true, it->second};
+        }
+
+        return {false, {}};
+    }
+
+    /// @brief Retrieves value of a key equal to the query of another type (heterogeneous lookup, see the find(const Query&)).
+    ///        Doesn't perform any bounds checking, behaviour is undefined if the key doesn't exist.
+    /// @tparam Query type of the query, automatically deduced by the compiler
+    /// @param key query
+    /// @return reference to constant to a value associated with the key (see value_reference)
+    template <typename Query, std::enable_if_t<detail::is_heterogeneous_v<Hash, KeyEqual, K, Query>, int> = 0>
+    // NOLINTNEXTLINE(fuchsia-overloaded-operator)
+    [[nodiscard]] constexpr value_reference operator[](const Query& key) const noexcept
+    {
+        return find(key)->second;
+    }
+
+    /// @brief Checks if element with a key equal to the query of another type exists (heterogeneous lookup, see the find(const Query&)).
+    /// @tparam Query type of the query, automatically deduced by the compiler
+    /// @param key query
+    /// @return boolean that denotes key's existence
+    template <typename Query, std::enable_if_t<detail::is_heterogeneous_v<Hash, KeyEqual, K, Query>, int> = 0>
+    [[nodiscard]] constexpr bool contains(const Query& key) const noexcept
+    {
+        return exists(key);
+    }
+
+    /// @brief Checks if element with key of the given characters exists (heterogeneous lookup, see the find(const Query&)).
+    /// @param characters first of the searched characters
+    /// @param count number of the searched characters
+    /// @return boolean that denotes key's existence
+    [[nodiscard]] constexpr bool contains(const char* characters, size_type count) const noexcept
+    {
+        return contains(std::string_view{characters, count});
+    }
+
+    /// @brief Searches map for all the keys in the range, results are written to the output in the same order.
+    ///        Keys are processed in groups, memory that lookups of the whole group need is prefetched first
+    ///        (if the backend can tell it, as backend::perfect_hash and backend::dense do), so that cache misses overlap.
+    /// @tparam ForwardIt iterator to keys (or to queries of heterogeneous lookup), automatically deduced by the compiler
+    /// @tparam OutputIt iterator to which const_iterator is assigned, automatically deduced by the compiler
+    /// @param first first key
+    /// @param last past the last key
+    /// @param output where results are written to, constant iterator to an element (cend, if not found) for each key
+    /// @return output past the last written result
+    template <typename ForwardIt, typename OutputIt>
+    constexpr OutputIt find_many(ForwardIt first, ForwardIt last, OutputIt output) const noexcept
+    {
+        return search_many(first, last, output, [this](index_type position) { return std::next(cbegin(), position); });
+    }
+
+    /// @brief Checks existence of all the keys in the range, results are written to the output in the same order.
+    ///        Keys are processed in groups the same way as in the find_many.
+    /// @tparam ForwardIt iterator to keys (or to queries of heterogeneous lookup), automatically deduced by the compiler
+    /// @tparam OutputIt iterator to which bool is assigned, automatically deduced by the compiler
+    /// @param first first key
+    /// @param last past the last key
+    /// @param output where results are written to, boolean that denotes key's existence for each key
+    /// @return output past the last written result
+    template <typename ForwardIt, typename OutputIt>
+    constexpr OutputIt contains_many(ForwardIt first, ForwardIt last, OutputIt output) const noexcept
+    {
+        return search_many(first, last, output, [](index_type position) { return position != N; });
+    }
+
+#if defined(CONSTEXPR_HASH_MAP_SPAN)
+    /// @brief Searches map for all the keys in the span, e.g. find_many(std::span{keys}, std::span{results}) (C++20), see the find_many(ForwardIt, ForwardIt, OutputIt).
+    /// @tparam Query type of the keys (or of the queries of heterogeneous lookup), automatically deduced by the compiler
+    /// @tparam Extent extent of the keys, automatically deduced by the compiler
+    /// @tparam ResultExtent extent of the results, automatically deduced by the compiler
+    /// @param keys keys to be searched for
+    /// @param results where results are written to, has to hold at least as many iterators as there are keys
+    /// @return written part of the results, constant iterator to an element (cend, if not found) for each key
+    template <typename Query, std::size_t Extent, std::size_t ResultExtent>
+    constexpr std::span<const_iterator> find_many(std::span<Query, Extent> keys, std::span<const_iterator, ResultExtent> results) const noexcept
+    {
+        find_many(keys.begin(), keys.end(), results.begin());
+
+        return results.first(keys.size());
+    }
+
+    /// @brief Checks existence of all the keys in the span (C++20), see the find_many(std::span<Query, Extent>, std::span<const_iterator, ResultExtent>).
+    /// @tparam Query type of the keys (or of the queries of heterogeneous lookup), automatically deduced by the compiler
+    /// @tparam Extent extent of the keys, automatically deduced by the compiler
+    /// @tparam ResultExtent extent of the results, automatically deduced by the compiler
+    /// @param keys keys to be searched for
+    /// @param results where results are written to, has to hold at least as many booleans as there are keys
+    /// @return written part of the results, boolean that denotes key's existence for each key
+    template <typename Query, std::size_t Extent, std::size_t ResultExtent>
+    constexpr std::span<bool> contains_many(std::span<Query, Extent> keys, std::span<bool, ResultExtent> results) const noexcept
+    {
+        contains_many(keys.begin(), keys.end(), results.begin());
+
+        return results.first(keys.size());
+    }
+#endif
+
+    /// @brief Retrieves lookup strategy of the map, e.g. the one chosen by the backend::automatic.
+    /// @return backend_kind of the Backend, backend_kind::custom for backends defined outside of this library
+    [[nodiscard]] constexpr backend_kind backend() const noexcept
+    {
+        if constexpr (detail::has_kind<lookup_type>::value)
+        {
+            return index.kind();
+        }
+        else if constexpr (detail::has_static_kind<Backend>::value)
+        {
+            return Backend::kind;
+        }
+        else
+        {
+            return backend_kind::custom;
+        }
     }
 
     /// @brief Retrieves size of a hash-map, might also be called indirectly using the std::size(...).
     /// @return total size of a container
     [[nodiscard]] constexpr size_type size() const noexcept
     {
-        return data.size();
+        return N;
     }
 
     /// @brief Gives constant iterator to a beginning, needed for the C++11 for-each cycle or the std::for_each.
@@ -105,7 +2779,7 @@ public:
     /// @see std::unordered_map<...>::cbegin()
     [[nodiscard]] constexpr const_iterator cbegin() const noexcept
     {
-        return std::cbegin(data);
+        return data.begin();
     }
 
     /// @brief Gives constant iterator to an end, needed for the C++11 for-each cycle or the std::for_each.
@@ -121,7 +2795,7 @@ public:
     /// @see std::unordered_map<...>::cend()
     [[nodiscard]] constexpr const_iterator cend() const noexcept
     {
-        return std::cend(data);
+        return data.end();
     }
 
     /// @brief Hash-map cannot be empty; this might also be called using std::empty(...).
@@ -135,41 +2809,419 @@ public:
 protected:
     /// @private type used for indexing elements
     using index_type = size_type;
+    /// @private lookup structure of the backend
+    using lookup_type = typename Backend::template index<N, K, Hash, typename Instrumentation::template key_equal<KeyEqual>>;
+    /// @private container for the elements
+    using storage_type = typename Layout::template storage<N, K, V>;
 
-    /// @private function that does a constexpr recursive searching of the array from left to right
-    template <index_type L, index_type R>
-    [[nodiscard]] constexpr const_iterator search(const K& key) const noexcept
+    /// @private gives keys of the elements passed to the constructor to the backend
+    struct keys_view
     {
-        if constexpr (L < R)
+        /// @private elements passed to the constructor
+        const data_type& elements;
+
+        /// @private key of i-th element
+        [[nodiscard]] constexpr const K& key(index_type i) const noexcept
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+            return elements[i].first;
+        }
+    };
+
+    /// @private returns position of the element with given key (or the one equal to the query), N if not found
+    template <typename Query>
+    [[nodiscard]] constexpr index_type search(const Query& key) const noexcept
+    {
+        if constexpr (Instrumentation::enabled)
         {
-            if (equal(data[L].first, key))
+            if (!detail::is_constant_evaluated())
             {
-                return std::next(cbegin(), L);
-            }
+                Instrumentation::start();
+                const auto position = index.find(data, key);
+                Instrumentation::record(position != N);
 
-            return search<L+1, R>(key);
+                return position;
+            }
         }
 
-        return cend();
+        return index.find(data, key);
     }
 
-    /// @private generic implementation that compares keys
-    template <typename T = K>
-    [[nodiscard]] constexpr bool equal(const T& lhs, const T& rhs) const noexcept
+    /// @private checks existence of the key (or of the one equal to the query), by the backend's contains if it has one
+    template <typename Query>
+    [[nodiscard]] constexpr bool exists(const Query& key) const noexcept
     {
-        return lhs == rhs;
+        if constexpr (detail::has_contains<lookup_type, storage_type, Query>::value)
+        {
+            if constexpr (Instrumentation::enabled)
+            {
+                if (!detail::is_constant_evaluated())
+                {
+                    Instrumentation::start();
+                    const auto found = index.contains(data, key);
+                    Instrumentation::record(found);
+
+                    return found;
+                }
+            }
+
+            return index.contains(data, key);
+        }
+        else
+        {
+            return search(key) != N;
+        }
     }
 
-    /// @private specific implementation for "const char*" equality is needed; uses recursion
-    [[nodiscard]] constexpr bool equal(const char* lhs, const char* rhs) const noexcept
+    /// @private keys are passed as they are, if they are of the key type or if heterogeneous lookup is possible, otherwise converted
+    template <typename Query>
+    [[nodiscard]] static constexpr decltype(auto) as_query(const Query& key) noexcept
     {
-        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-        return *lhs == *rhs && (*lhs == '\0' || equal(lhs + 1, rhs + 1));
+        if constexpr (std::is_same_v<Query, K> || detail::is_heterogeneous_v<Hash, KeyEqual, K, Query>)
+        {
+            return (key);
+        }
+        else
+        {
+            return K(key);
+        }
+    }
+
+    /// @private searches for keys in groups, memory needed by lookups of a group is prefetched first (at runtime)
+    template <typename ForwardIt, typename OutputIt, typename Result>
+    constexpr OutputIt search_many(ForwardIt first, ForwardIt last, OutputIt output, const Result& result) const noexcept
+    {
+        using query_type = std::decay_t<decltype(as_query(*first))>;
+
+        while (first != last)
+        {
+            auto group_end = first;
+
+            for (std::size_t i = 0; i < detail::batch_size && group_end != last; ++i, ++group_end)
+            {
+                if constexpr (detail::has_prefetch<lookup_type, storage_type, query_type>::value)
+                {
+                    if (!detail::is_constant_evaluated())
+                    {
+                        index.prefetch(data, as_query(*group_end));
+                    }
+                }
+            }
+
+            for (; first != group_end; ++first, ++output)
+            {
+                *output = result(search(as_query(*first)));
+            }
+        }
+
+        return output;
     }
 
 private:
-    data_type data;
+    /// @private builds the index and stores elements in the order required by the backend
+    CONSTEXPR_HASH_MAP_BUILD hash_map(detail::build_tag, data_type entries) noexcept
+    : hash_map{entries, lookup_type::build(keys_view{entries})}
+    {
+    }
+
+    /// @private stores already built index
+    CONSTEXPR_HASH_MAP_BUILD hash_map(const data_type& entries, const detail::build_result<lookup_type, N>& built) noexcept
+    : index{built.index}, data{entries, built.order}
+    {
+    }
+
+    lookup_type index;
+    storage_type data;
+};
+
+/// @brief Deduces N, K and V from the pairs passed to the constructor, e.g. hash_map{std::make_pair("key", 1)} is hash_map<1, const char*, int>.
+template <typename K, typename V, typename... R>
+hash_map(std::pair<K, V>, R...) -> hash_map<1 + sizeof...(R), K, V>;
+
+/// @brief Deduces N, K and V from the array passed to the constructor.
+template <std::size_t N, typename K, typename V>
+hash_map(std::array<std::pair<K, V>, N>) -> hash_map<N, K, V>;
+
+/// @private implementation details, not part of the public interface
+namespace detail
+{
+/// @private gathers elements given by the generator called with 0 ... N - 1 and constructs the map
+template <typename Map, typename Generator, std::size_t... I>
+[[nodiscard]] CONSTEXPR_HASH_MAP_BUILD Map generate(const Generator& generator, std::index_sequence<I...>) noexcept
+{
+    return Map{typename Map::data_type{generator(I)...}};
+}
+}  // namespace detail
+
+/// @brief Constructs the map from elements computed at compile time, e.g. from another constexpr table.
+/// @tparam Map type of the ct::hash_map to be constructed
+/// @tparam Generator constexpr function object, deduced by the compiler
+/// @param generator called with every position 0 ... N - 1, gives std::pair<K, V> (or anything convertible to it)
+/// @return constructed map; when used to initialize a constexpr map, nothing is left for the runtime
+template <typename Map, typename Generator>
+[[nodiscard]] CONSTEXPR_HASH_MAP_BUILD Map make_hash_map(const Generator& generator) noexcept
+{
+    return detail::generate<Map>(generator, std::make_index_sequence<std::tuple_size_v<typename Map::data_type>>{});
+}
+
+/// @brief Constructs the map from values to keys of the given map, values have to be unique.
+/// @tparam Inverted type of the resulting ct::hash_map; if void, it's the hash_map<N, V, K> with default template arguments
+/// @param map map to be inverted
+/// @return map, where keys are the values of the given map and values its keys
+template <typename Inverted = void, std::size_t N, typename K, typename V, typename Hash, typename KeyEqual, typename Backend, typename Layout, typename Instrumentation>
+[[nodiscard]] CONSTEXPR_HASH_MAP_BUILD auto invert(const hash_map<N, K, V, Hash, KeyEqual, Backend, Layout, Instrumentation>& map) noexcept
+{
+    using inverted_type = std::conditional_t<std::is_void_v<Inverted>, hash_map<N, V, K>, Inverted>;
+
+    return make_hash_map<inverted_type>([&map](std::size_t i) {
+        const auto element = std::next(map.cbegin(), static_cast<std::ptrdiff_t>(i));
+
+        return std::pair<V, K>{element->second, element->first};
+    });
+}
+
+/// @private implementation details, not part of the public interface
+namespace detail
+{
+/// @private type of the map derived from the Map, with M elements and values of the type U;
+///          template arguments are kept, except for the layout::string_pool (sized for other strings), which becomes the layout::aos
+template <typename Map, std::size_t M, typename U>
+struct derived_map;
+
+/// @private see the derived_map
+template <std::size_t N, typename K, typename V, typename Hash, typename KeyEqual, typename Backend, typename Layout, typename Instrumentation,
+          std::size_t M, typename U>
+struct derived_map<hash_map<N, K, V, Hash, KeyEqual, Backend, Layout, Instrumentation>, M, U>
+{
+    using type = hash_map<M, K, U, Hash, KeyEqual, Backend, std::conditional_t<std::is_same_v<Layout, layout::soa>, layout::soa, layout::aos>, Instrumentation>;
+};
+
+/// @private see the derived_map
+template <typename Map, std::size_t M, typename U = typename std::decay_t<Map>::value_type>
+using derived_map_t = typename derived_map<std::decay_t<Map>, M, U>::type;
+
+/// @private positions (in the iteration order) of the elements of the map that the predicate keeps, Count of them
+template <const auto& Map, std::size_t Count, typename Predicate>
+[[nodiscard]] constexpr std::array<std::size_t, Count> positions_if(Predicate predicate) noexcept
+{
+    std::array<std::size_t, Count> result{};
+    std::size_t kept = 0;
+    std::size_t position = 0;
+
+    for (auto element = Map.cbegin(); element != Map.cend(); ++element, ++position)
+    {
+        if (predicate(element->first, element->second))
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+            result[kept++] = position;
+        }
+    }
+
+    return result;
+}
+
+/// @private number of elements of the map that the predicate keeps
+template <const auto& Map, typename Predicate>
+[[nodiscard]] constexpr std::size_t count_if(Predicate predicate) noexcept
+{
+    std::size_t result = 0;
+
+    for (auto element = Map.cbegin(); element != Map.cend(); ++element)
+    {
+        result += predicate(element->first, element->second) ? 1 : 0;
+    }
+
+    return result;
+}
+
+/// @private keeps elements of the Right, whose keys aren't in the Left
+template <const auto& Left>
+struct not_in
+{
+    /// @private true for keys that aren't in the Left
+    template <typename Key, typename Value>
+    [[nodiscard]] constexpr bool operator()(const Key& key, const Value& /*value*/) const noexcept
+    {
+        return !Left.contains(key);
+    }
+};
+}  // namespace detail
+
+/// @brief Constructs the map of the elements of both maps, values of the Right override those of the Left for the same keys
+///        (e.g. platform overrides of the defaults); index of the result is built anew, so lookups stay as fast as in the originals.
+/// @details Result has the elements of the Left (in its order) followed by those of the Right with new keys; it's of the type of the Left,
+///          with the number of elements of the union (and the layout::aos instead of the layout::string_pool).
+/// @tparam Left constexpr ct::hash_map with the static storage duration
+/// @tparam Right constexpr ct::hash_map with the static storage duration, of the same keys and of values convertible to those of the Left
+/// @return merged map; when used to initialize a constexpr map, nothing is left for the runtime
+template <const auto& Left, const auto& Right>
+[[nodiscard]] CONSTEXPR_HASH_MAP_BUILD auto merge() noexcept
+{
+    using left_type = std::decay_t<decltype(Left)>;
+    using right_type = std::decay_t<decltype(Right)>;
+
+    static_assert(std::is_same_v<typename left_type::key_type, typename right_type::key_type>, "Maps should have the same type of keys");
+    static_assert(std::is_convertible_v<typename right_type::value_type, typename left_type::value_type>, "Values of the Right should be convertible to those of the Left");
+
+    constexpr auto added_count = detail::count_if<Right>(detail::not_in<Left>{});
+    constexpr auto added = detail::positions_if<Right, added_count>(detail::not_in<Left>{});
+
+    using merged_type = detail::derived_map_t<left_type, Left.size() + added_count>;
+    using element_type = typename merged_type::data_type::value_type;
+
+    return make_hash_map<merged_type>([&added](std::size_t i) {
+        if (i < Left.size())
+        {
+            const auto element = std::next(Left.cbegin(), static_cast<std::ptrdiff_t>(i));
+            const auto overriding = Right.find(element->first);
+
+            return element_type{element->first, overriding != Right.cend() ? overriding->second : element->second};
+        }
+
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+        const auto element = std::next(Right.cbegin(), static_cast<std::ptrdiff_t>(added[i - Left.size()]));
+
+        return element_type{element->first, element->second};
+    });
+}
+
+/// @brief Constructs the map of the elements that the predicate keeps, with the index built anew.
+/// @details Result is of the type of the Map, with the number of kept elements (and the layout::aos instead of the layout::string_pool);
+///          at least one element has to be kept.
+/// @tparam Map constexpr ct::hash_map with the static storage duration
+/// @tparam Predicate constexpr function object without state (e.g. a lambda without captures), automatically deduced by the compiler
+/// @param predicate called with the key and the value of every element, returns true for those to be kept
+/// @return filtered map; when used to initialize a constexpr map, nothing is left for the runtime
+template <const auto& Map, typename Predicate>
+[[nodiscard]] CONSTEXPR_HASH_MAP_BUILD auto filter(Predicate predicate) noexcept
+{
+    constexpr auto kept_count = detail::count_if<Map>(predicate);
+    static_assert(kept_count > 0, "Predicate should keep at least one element");
+
+    constexpr auto kept = detail::positions_if<Map, kept_count>(predicate);
+
+    using filtered_type = detail::derived_map_t<decltype(Map), kept_count>;
+    using element_type = typename filtered_type::data_type::value_type;
+
+    return make_hash_map<filtered_type>([&kept](std::size_t i) {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+        const auto element = std::next(Map.cbegin(), static_cast<std::ptrdiff_t>(kept[i]));
+
+        return element_type{element->first, element->second};
+    });
+}
+
+/// @brief Constructs the map of the same keys with values given by the function, with the index built anew.
+/// @tparam Transformed type of the resulting ct::hash_map; if void, it's the type of the map with values of the type the function returns
+///         (and the layout::aos instead of the layout::string_pool)
+/// @tparam Function constexpr function object, automatically deduced by the compiler
+/// @param map map to be transformed
+/// @param function called with the key and the value of every element, gives the new value
+/// @return map, where keys are those of the given map and values those given by the function
+template <typename Transformed = void, std::size_t N, typename K, typename V, typename Hash, typename KeyEqual, typename Backend, typename Layout,
+          typename Instrumentation, typename Function>
+[[nodiscard]] CONSTEXPR_HASH_MAP_BUILD auto transform_values(const hash_map<N, K, V, Hash, KeyEqual, Backend, Layout, Instrumentation>& map, const Function& function) noexcept
+{
+    using map_type = hash_map<N, K, V, Hash, KeyEqual, Backend, Layout, Instrumentation>;
+    using result_value_type = std::decay_t<std::invoke_result_t<const Function&, const K&, typename map_type::value_reference>>;
+    using transformed_type = std::conditional_t<std::is_void_v<Transformed>, detail::derived_map_t<map_type, N, result_value_type>, Transformed>;
+    using element_type = typename transformed_type::data_type::value_type;
+
+    return make_hash_map<transformed_type>([&map, &function](std::size_t i) {
+        const auto element = std::next(map.cbegin(), static_cast<std::ptrdiff_t>(i));
+
+        return element_type{element->first, function(element->first, element->second)};
+    });
+}
+
+#if defined(CONSTEXPR_HASH_MAP_CLASS_TEMPLATE_ARGUMENTS)
+/// @brief String literal usable as a template argument (C++20), e.g. get<map, "key">().
+/// @tparam Size number of characters including the terminating null, deduced from the literal
+template <std::size_t Size>
+struct fixed_string
+{
+    /// @brief constructs from the string literal
+    /// @param literal null-terminated characters
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays, hicpp-avoid-c-arrays, modernize-avoid-c-arrays, google-explicit-constructor, hicpp-explicit-conversions)
+    constexpr fixed_string(const char (&literal)[Size]) noexcept
+    {
+        for (std::size_t i = 0; i < Size; ++i)
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+            characters[i] = literal[i];
+        }
+    }
+
+    /// @brief null-terminated characters
+    std::array<char, Size> characters{};
 };
+#endif
+
+/// @private implementation details, not part of the public interface
+namespace detail
+{
+/// @private position of the key in the map, size of the map if it's missing
+template <const auto& Map, typename Query>
+[[nodiscard]] constexpr std::size_t position_of(const Query& key) noexcept
+{
+    return static_cast<std::size_t>(std::distance(Map.cbegin(), Map.find(key)));
+}
+
+/// @private keys passed to the get<Map, Key>() directly, character arrays are passed as the fixed_string if it's available
+template <typename Key>
+constexpr bool is_key_argument_v =
+#if defined(CONSTEXPR_HASH_MAP_CLASS_TEMPLATE_ARGUMENTS)
+    !std::is_same_v<Key, const char*>;
+#else
+    true;
+#endif
+
+/// @private value at the position computed at compile time, fails to compile if the key wasn't found
+template <const auto& Map, std::size_t Position>
+[[nodiscard]] constexpr typename std::decay_t<decltype(Map)>::value_reference value_at() noexcept
+{
+    static_assert(Position != Map.size(), "Key is not in the map");
+
+    return std::next(Map.cbegin(), static_cast<std::ptrdiff_t>(Position))->second;
+}
+}  // namespace detail
+
+/// @brief Retrieves value of a key known at compile time; position of the key is found by the compiler,
+///        so that (unlike the operator[] in the runtime code) nothing but a load of the value is left, even for big maps.
+///        Fails to compile if the key doesn't exist.
+/// @tparam Map constexpr ct::hash_map with the static storage duration
+/// @tparam Key integral or enumeration key, pointer to a null-terminated array with the static storage duration,
+///             or a string literal (only with C++20, see the fixed_string)
+/// @return reference to constant to a value associated with the key (see hash_map::value_reference)
+template <const auto& Map, auto Key, std::enable_if_t<detail::is_key_argument_v<decltype(Key)>, int> = 0>
+[[nodiscard]] constexpr decltype(auto) get() noexcept
+{
+    return detail::value_at<Map, detail::position_of<Map>(Key)>();
+}
+
+#if defined(CONSTEXPR_HASH_MAP_CLASS_TEMPLATE_ARGUMENTS)
+/// @brief Retrieves value of a key given by the string literal, e.g. get<map, "key">(), see the get<Map, Key>().
+/// @tparam Map constexpr ct::hash_map with the static storage duration
+/// @tparam Key string literal
+/// @return reference to constant to a value associated with the key (see hash_map::value_reference)
+template <const auto& Map, fixed_string Key>
+[[nodiscard]] constexpr decltype(auto) get() noexcept
+{
+    return detail::value_at<Map, detail::position_of<Map>(Key.characters.data())>();
+}
+#endif
+
+/// @brief Retrieves value of a key returned by the constexpr function, e.g. get<map>([] { return "key"; }),
+///        usable for string literals with C++17; see the get<Map, Key>().
+/// @tparam Map constexpr ct::hash_map with the static storage duration
+/// @tparam KeyFunction constexpr function object without state, automatically deduced by the compiler
+/// @param key returns the key
+/// @return reference to constant to a value associated with the key (see hash_map::value_reference)
+template <const auto& Map, typename KeyFunction>
+[[nodiscard]] constexpr decltype(auto) get([[maybe_unused]] KeyFunction key) noexcept
+{
+    return detail::value_at<Map, detail::position_of<Map>(key())>();
+}
 }  // namespace burda::ct
 
 #endif // CONSTEXPR_HASH_MAP_CONSTEXPR_HASH_MAP_HPP
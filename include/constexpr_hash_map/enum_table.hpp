@@ -0,0 +1,290 @@
+#ifndef CONSTEXPR_HASH_MAP_ENUM_TABLE_HPP
+#define CONSTEXPR_HASH_MAP_ENUM_TABLE_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include <constexpr_hash_map/constexpr_hash_map.hpp>
+
+namespace burda::ct
+{
+/// @private implementation details, not part of the public interface
+namespace detail
+{
+/// @private gives names of the list to the backend
+template <const auto& Names>
+struct name_keys
+{
+    /// @private name of the i-th pair
+    [[nodiscard]] constexpr std::string_view key(std::size_t i) const noexcept
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+        return std::string_view{Names[i].second};
+    }
+};
+
+/// @private tables of the enum_table with names (in the order of slots of the index) of enumerators of the type E;
+///          enumerators in a narrow range are looked up in the dense array of Span slots, others among the Sorted slots
+template <typename E, std::size_t N, std::size_t Bytes, std::size_t Span, std::size_t Sorted>
+struct enum_tables
+{
+    /// @private names in the order of slots of the index
+    pooled_strings<N, Bytes> names;
+    /// @private enumerators[slot] is the enumerator named by the name in the slot
+    std::array<E, N> enumerators{};
+    /// @private dense[offset] is the slot of the (first) name of the enumerator "smallest + offset", N if it has none
+    std::array<position_t<N>, Span> dense{};
+    /// @private slots ordered by their enumerators (the first name of aliases first), used instead of the dense array
+    std::array<position_t<N>, Sorted> sorted{};
+    /// @private smallest enumerator
+    E smallest{};
+};
+
+/// @private distance of the enumerator from the smallest one, computed in the unsigned type of the same size, so it doesn't overflow
+template <typename E>
+[[nodiscard]] constexpr std::uint64_t enumerator_offset(E value, E smallest) noexcept
+{
+    using unsigned_type = decltype(to_unsigned(value));
+
+    return static_cast<unsigned_type>(to_unsigned(value) - to_unsigned(smallest));
+}
+
+/// @private smallest enumerator of the list
+template <const auto& Names>
+[[nodiscard]] constexpr auto smallest_enumerator() noexcept
+{
+    auto result = Names[0].first;
+
+    for (const auto& name : Names)
+    {
+        result = name.first < result ? name.first : result;
+    }
+
+    return result;
+}
+
+/// @private number of enumerators between the smallest and the largest one (both included)
+template <const auto& Names>
+[[nodiscard]] constexpr std::uint64_t enumerator_span() noexcept
+{
+    std::uint64_t result = 0;
+
+    for (const auto& name : Names)
+    {
+        const auto offset = enumerator_offset(name.first, smallest_enumerator<Names>());
+        result = offset + 1 > result ? offset + 1 : result;
+    }
+
+    return result;
+}
+
+/// @private fills the tables from the list and the order of names in slots of the index
+template <const auto& Names, typename Tables, std::size_t N>
+[[nodiscard]] constexpr Tables build_enum_tables(const std::array<std::size_t, N>& order) noexcept
+{
+    Tables result{};
+    std::array<std::size_t, N> slots{};
+
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+    result.names = decltype(result.names)::pack([&order](std::size_t slot) { return std::string_view{Names[order[slot]].second}; });
+    result.smallest = smallest_enumerator<Names>();
+
+    for (std::size_t slot = 0; slot < N; ++slot)
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+        result.enumerators[slot] = Names[order[slot]].first;
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+        slots[order[slot]] = slot;
+    }
+
+    if constexpr (std::tuple_size_v<decltype(result.dense)> > 0)
+    {
+        for (auto& slot : result.dense)
+        {
+            slot = static_cast<position_t<N>>(N);
+        }
+
+        // aliases are named by their first name in the list
+        for (std::size_t position = 0; position < N; ++position)
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+            auto& slot = result.dense[enumerator_offset(Names[position].first, result.smallest)];
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+            slot = slot == N ? static_cast<position_t<N>>(slots[position]) : slot;
+        }
+    }
+    else
+    {
+        std::array<std::size_t, N> positions{};
+
+        for (std::size_t position = 0; position < N; ++position)
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+            positions[position] = position;
+        }
+
+        heap_sort(positions, [](std::size_t lhs, std::size_t rhs) {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+            return Names[lhs].first < Names[rhs].first || (Names[lhs].first == Names[rhs].first && lhs < rhs);
+        });
+
+        for (std::size_t rank = 0; rank < N; ++rank)
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+            result.sorted[rank] = static_cast<position_t<N>>(slots[positions[rank]]);
+        }
+    }
+
+    return result;
+}
+}  // namespace detail
+
+/// @brief Conversions of enumerators to their names and back, built at compile time from one list of (enumerator, name) pairs:
+///        names are stored once in a string pool (in the order of slots of the index of the Backend, the backend::perfect_hash by default),
+///        from_string looks the name up by the index and to_string reads the slot of the enumerator from a dense array indexed by it,
+///        so both directions are O(1).
+/// @details Enumerators in a range that is at most four times the number of names (or 64) are looked up in the dense array,
+///          sparser ones (e.g. flags) by a binary search among the sorted ones. Enumerator might have more names (aliases),
+///          to_string gives the first one; the same name twice is a compile error.
+/// @tparam Names constexpr std::array of std::pair<E, S> with the static storage duration, E is an enumeration and S convertible to the std::string_view
+/// @tparam Hash constexpr and default constructible function object giving std::uint64_t hashes of names, see ct::hash
+/// @tparam KeyEqual constexpr and default constructible function object comparing names, e.g. ct::case_insensitive_equal_to (with the ct::case_insensitive_hash)
+/// @tparam Backend lookup strategy of names, one of the types from the burda::ct::backend namespace
+template <const auto& Names, typename Hash = hash<std::string_view>, typename KeyEqual = equal_to<std::string_view>, typename Backend = backend::perfect_hash>
+class enum_table
+{
+public:
+    /// @brief list of (enumerator, name) pairs
+    using list_type = std::decay_t<decltype(Names)>;
+    /// @brief enumeration, that is converted
+    using enum_type = std::decay_t<decltype(Names[0].first)>;
+    /// @see std::unordered_map<...>::size_type
+    using size_type = std::size_t;
+
+    static_assert(std::is_enum_v<enum_type>, "Names should be paired with enumerators");
+    static_assert(std::is_convertible_v<decltype(Names[0].second), std::string_view>, "Names should be strings");
+
+    /// @brief Gives the name of the enumerator.
+    /// @param value enumerator
+    /// @return its (first) name, empty if it has none
+    [[nodiscard]] static constexpr std::string_view to_string(enum_type value) noexcept
+    {
+        const auto slot = slot_of(value);
+
+        return slot != count ? tables.names.template get<std::string_view>(slot) : std::string_view{};
+    }
+
+    /// @brief Gives the enumerator of the name.
+    /// @param name name to be searched for
+    /// @return pair, where first denotes whether the name was found, second the enumerator
+    [[nodiscard]] static constexpr std::pair<bool, enum_type> from_string(std::string_view name) noexcept
+    {
+        const auto slot = index.find(pooled_names{}, name);
+
+        if (slot != count)
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+            return {true, tables.enumerators[slot]};
+        }
+
+        return {false, enum_type{}};
+    }
+
+    /// @brief Checks if the enumerator has a name.
+    /// @param value enumerator
+    /// @return boolean that denotes existence of its name
+    [[nodiscard]] static constexpr bool contains(enum_type value) noexcept
+    {
+        return slot_of(value) != count;
+    }
+
+    /// @brief Checks if the name exists.
+    /// @param name name to be searched for
+    /// @return boolean that denotes existence of the name
+    [[nodiscard]] static constexpr bool contains(std::string_view name) noexcept
+    {
+        return from_string(name).first;
+    }
+
+    /// @brief Retrieves number of names.
+    /// @return number of pairs of the list
+    [[nodiscard]] static constexpr size_type size() noexcept
+    {
+        return count;
+    }
+
+    /// @brief Tells whether to_string reads the dense array (enumerators are in a narrow range), or searches the sorted enumerators.
+    /// @return true for the dense array
+    [[nodiscard]] static constexpr bool is_dense() noexcept
+    {
+        return dense;
+    }
+
+private:
+    static constexpr std::size_t count = std::tuple_size_v<list_type>;
+    static constexpr std::uint64_t span = detail::enumerator_span<Names>();
+    static constexpr std::uint64_t smallest_dense_span = 64;
+    static constexpr bool dense = span <= (count * 4 < smallest_dense_span ? smallest_dense_span : count * 4);
+
+    using lookup_type = typename Backend::template index<count, std::string_view, Hash, KeyEqual>;
+    using tables_type = detail::enum_tables<enum_type, count, layout::pooled_value_bytes(Names), dense ? static_cast<std::size_t>(span) : 0, dense ? 0 : count>;
+
+    static constexpr auto built = lookup_type::build(detail::name_keys<Names>{});
+    static constexpr lookup_type index = built.index;
+    static constexpr tables_type tables = detail::build_enum_tables<Names, tables_type>(built.order);
+
+    /// @private gives names in the pool to the backend
+    struct pooled_names
+    {
+        /// @private name in the slot
+        [[nodiscard]] constexpr std::string_view key(std::size_t slot) const noexcept
+        {
+            return tables.names.template get<std::string_view>(slot);
+        }
+    };
+
+    /// @private slot of the (first) name of the enumerator, count if it has none
+    [[nodiscard]] static constexpr std::size_t slot_of(enum_type value) noexcept
+    {
+        if constexpr (dense)
+        {
+            const auto offset = detail::enumerator_offset(value, tables.smallest);
+
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+            return offset < span ? tables.dense[offset] : count;
+        }
+        else
+        {
+            // the first of the sorted enumerators that isn't less than the value
+            std::size_t first = 0;
+            std::size_t length = count;
+
+            while (length > 0)
+            {
+                const auto half = length / 2;
+
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+                if (tables.enumerators[tables.sorted[first + half]] < value)
+                {
+                    first += half + 1;
+                    length -= half + 1;
+                }
+                else
+                {
+                    length = half;
+                }
+            }
+
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+            return first < count && tables.enumerators[tables.sorted[first]] == value ? tables.sorted[first] : count;
+        }
+    }
+};
+}  // namespace burda::ct
+
+#endif // CONSTEXPR_HASH_MAP_ENUM_TABLE_HPP
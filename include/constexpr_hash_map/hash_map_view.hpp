@@ -0,0 +1,335 @@
+#ifndef CONSTEXPR_HASH_MAP_HASH_MAP_VIEW_HPP
+#define CONSTEXPR_HASH_MAP_HASH_MAP_VIEW_HPP
+
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include <constexpr_hash_map/constexpr_hash_map.hpp>
+
+namespace burda::ct
+{
+/// @private implementation details, not part of the public interface
+namespace detail
+{
+/// @private first bytes of the image
+constexpr std::string_view image_magic{"CTHM"};
+/// @private version of the image layout
+constexpr std::uint32_t image_version = 1;
+/// @private size of the header of the image, seeds follow it
+constexpr std::size_t image_header_size = 32;
+/// @private offset of the version in the header (it follows the magic)
+constexpr std::size_t image_version_offset = 4;
+/// @private offset of the bits of keys in the header
+constexpr std::size_t image_key_bits_offset = 8;
+/// @private offset of the bits of values in the header
+constexpr std::size_t image_value_bits_offset = 12;
+/// @private offset of the flags in the header
+constexpr std::size_t image_flags_offset = 16;
+/// @private offset of the number of elements in the header
+constexpr std::size_t image_count_offset = 20;
+/// @private offset of the (64-bit) size of the image in the header
+constexpr std::size_t image_size_offset = 24;
+/// @private seeds are padded, so that keys and values are aligned to it
+constexpr std::size_t image_alignment = 8;
+/// @private position of the length in the stored string (the offset is in the lower half)
+constexpr unsigned image_length_shift = 32;
+/// @private flag of the header, keys are hashed (and compared) case-insensitively
+constexpr std::uint32_t image_case_insensitive = 1;
+
+/// @private unsigned integer stored in little-endian bytes, read by a single (unaligned) load at runtime on little-endian targets
+template <typename T>
+[[nodiscard]] constexpr T load_little_endian(const char* bytes) noexcept
+{
+    T result = 0;
+
+#if (defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__) || defined(_MSC_VER)
+    if (!is_constant_evaluated())
+    {
+        std::memcpy(&result, bytes, sizeof(T));
+
+        return result;
+    }
+#endif
+
+    for (std::size_t i = 0; i < sizeof(T); ++i)
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        result |= static_cast<T>(static_cast<T>(static_cast<unsigned char>(bytes[i])) << (CHAR_BIT * i));
+    }
+
+    return result;
+}
+
+/// @private bits with which keys (or values) of the type are stored in the image, 0 for strings
+template <typename T>
+constexpr std::uint32_t image_bits = std::is_same_v<T, std::string_view> ? 0 : static_cast<std::uint32_t>(sizeof(T) * CHAR_BIT);
+
+/// @private offset of the keys of the image with given number of elements, they follow the padded seeds
+[[nodiscard]] constexpr std::uint64_t image_keys_offset(std::uint64_t elements) noexcept
+{
+    return image_header_size + (elements * sizeof(std::uint32_t) + image_alignment - 1) / image_alignment * image_alignment;
+}
+}  // namespace detail
+
+/// @brief Read-only view of a hash-map serialized to a binary image (e.g. by the tools/generate_hash_map.py --format image) and mapped
+///        to memory, for tables too big for the compiler; lookups are the same as those of the backend::perfect_hash and nothing is
+///        deserialized or copied: the view only checks the header and reads the image in place.
+/// @details Image is position-independent (addressed by offsets from its beginning), little-endian and 8-byte aligned:
+///          a header of 32 bytes ("CTHM", version, bits of keys and values (0 for strings), flags, number of elements N, size of the image),
+///          N 32-bit seeds of the buckets, N 64-bit keys and N 64-bit values in the order of slots and characters of the strings.
+///          Integers are stored as they are, strings as the 32-bit offset of their characters with the 32-bit length in the upper half.
+///          Image that doesn't match the view (other types, corrupted header) gives an invalid view, that is empty;
+///          a key of a corrupted image is never read outside of the image.
+/// @tparam K data type for keys, std::string_view or an integral type
+/// @tparam V data type for values, std::string_view or an integral type
+/// @tparam Hash hash of the keys that the image was generated with, ct::hash or ct::case_insensitive_hash
+/// @tparam KeyEqual constexpr and default constructible function object comparing keys, see ct::equal_to
+template <typename K, typename V, typename Hash = hash<K>, typename KeyEqual = equal_to<K>>
+class hash_map_view
+{
+    static_assert(std::is_same_v<K, std::string_view> || std::is_integral_v<K>, "Keys should be std::string_view or integral");
+    static_assert(std::is_same_v<V, std::string_view> || std::is_integral_v<V>, "Values should be std::string_view or integral");
+
+    /// @private reads the elements from the image
+    class storage
+    {
+    public:
+        /// @private empty storage
+        constexpr storage() noexcept = default;
+
+        /// @private storage of a valid image with given number of elements
+        constexpr storage(const char* image, std::size_t image_size, std::size_t elements) noexcept
+        : bytes{image}, size{image_size}, count{elements}, keys{static_cast<std::size_t>(detail::image_keys_offset(elements))},
+          values{keys + elements * sizeof(std::uint64_t)}
+        {
+        }
+
+        /// @private number of elements
+        [[nodiscard]] constexpr std::size_t elements() const noexcept
+        {
+            return count;
+        }
+
+        /// @private seed of the bucket
+        [[nodiscard]] constexpr std::uint32_t seed(std::size_t bucket) const noexcept
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            return detail::load_little_endian<std::uint32_t>(bytes + detail::image_header_size + bucket * sizeof(std::uint32_t));
+        }
+
+        /// @private key of the element in the slot
+        [[nodiscard]] constexpr K key(std::size_t slot) const noexcept
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            return decode<K>(detail::load_little_endian<std::uint64_t>(bytes + keys + slot * sizeof(std::uint64_t)));
+        }
+
+        /// @private value of the element in the slot
+        [[nodiscard]] constexpr V value(std::size_t slot) const noexcept
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            return decode<V>(detail::load_little_endian<std::uint64_t>(bytes + values + slot * sizeof(std::uint64_t)));
+        }
+
+    private:
+        /// @private integer as it is, string from its offset and length (empty, if it doesn't lie in the image)
+        template <typename T>
+        [[nodiscard]] constexpr T decode(std::uint64_t stored) const noexcept
+        {
+            if constexpr (std::is_same_v<T, std::string_view>)
+            {
+                const auto offset = static_cast<std::size_t>(stored & UINT32_MAX);
+                const auto length = static_cast<std::size_t>(stored >> detail::image_length_shift);
+
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                return offset <= size && length <= size - offset ? std::string_view{bytes + offset, length} : std::string_view{};
+            }
+            else
+            {
+                return static_cast<T>(stored);
+            }
+        }
+
+        const char* bytes = nullptr;
+        std::size_t size = 0;
+        std::size_t count = 0;
+        std::size_t keys = 0;
+        std::size_t values = 0;
+    };
+
+public:
+    /// @see std::unordered_map<...>::key_type
+    using key_type = K;
+    /// @see std::unordered_map<...>::value_type
+    using value_type = V;
+    /// @see std::unordered_map<...>::size_type
+    using size_type = std::size_t;
+    /// @brief random-access iterator giving std::pair<K, V> read from the image
+    using const_iterator = detail::proxy_iterator<storage>;
+    /// @see std::unordered_map<...>::hasher
+    using hasher = Hash;
+    /// @see std::unordered_map<...>::key_equal
+    using key_equal = KeyEqual;
+
+    /// @brief Invalid (empty) view.
+    constexpr hash_map_view() noexcept = default;
+
+    /// @brief View of the image, e.g. a constexpr array of characters; checks the header in O(1).
+    /// @param image first byte of the image, has to stay valid (and mapped) while the view is used
+    /// @param image_size number of bytes available from the image (e.g. size of the mapped file)
+    constexpr hash_map_view(const char* image, size_type image_size) noexcept
+    {
+        if (image == nullptr || image_size < detail::image_header_size || std::string_view{image, detail::image_magic.size()} != detail::image_magic)
+        {
+            return;
+        }
+
+        // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        const auto version = detail::load_little_endian<std::uint32_t>(image + detail::image_version_offset);
+        const auto key_bits = detail::load_little_endian<std::uint32_t>(image + detail::image_key_bits_offset);
+        const auto value_bits = detail::load_little_endian<std::uint32_t>(image + detail::image_value_bits_offset);
+        const auto flags = detail::load_little_endian<std::uint32_t>(image + detail::image_flags_offset);
+        const auto count = detail::load_little_endian<std::uint32_t>(image + detail::image_count_offset);
+        const auto total_size = detail::load_little_endian<std::uint64_t>(image + detail::image_size_offset);
+        // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+        const std::uint32_t expected_flags = std::is_same_v<Hash, case_insensitive_hash> ? detail::image_case_insensitive : 0;
+        const auto tables_end = detail::image_keys_offset(count) + std::uint64_t{count} * 2U * sizeof(std::uint64_t);
+
+        if (version == detail::image_version && key_bits == detail::image_bits<K> && value_bits == detail::image_bits<V> && flags == expected_flags
+            && count > 0 && tables_end <= total_size && total_size <= image_size)
+        {
+            data = storage{image, static_cast<size_type>(total_size), count};
+        }
+    }
+
+    /// @brief Invalid (empty) view of no image, e.g. of a mapping that failed; the same as the hash_map_view().
+    constexpr hash_map_view(std::nullptr_t, size_type) noexcept
+    {
+    }
+
+    /// @brief View of the image mapped to memory, e.g. by the mmap(...) or the MapViewOfFile(...); see the hash_map_view(const char*, size_type).
+    /// @param image first byte of the image, should be aligned to 8 bytes (as the mapped memory is)
+    /// @param image_size number of bytes available from the image
+    hash_map_view(const void* image, size_type image_size) noexcept
+    : hash_map_view{static_cast<const char*>(image), image_size}
+    {
+    }
+
+    /// @brief Tells whether the image matched the view, a view of an image that didn't is empty.
+    /// @return true, if the image is valid and of the types of the view
+    [[nodiscard]] constexpr bool valid() const noexcept
+    {
+        return data.elements() > 0;
+    }
+
+    /// @brief Searches the image for a given key and returns iterator.
+    /// @param key key to be searched for
+    /// @return constant iterator to an element (cend, if not found)
+    [[nodiscard]] constexpr const_iterator find(const K& key) const noexcept
+    {
+        return std::next(cbegin(), static_cast<std::ptrdiff_t>(search(key)));
+    }
+
+    /// @brief Searches for a given key, aimed to return associated value with it.
+    /// @param key key to be searched for
+    /// @return pair, where first denotes whether element was found, second given value
+    [[nodiscard]] constexpr std::pair<bool, V> at(const K& key) const noexcept
+    {
+        const auto slot = search(key);
+
+        if (slot != data.elements())
+        {
+            return {true, data.value(slot)};
+        }
+
+        return {false, {}};
+    }
+
+    /// @brief Retrieves a value, behaviour is undefined if the key doesn't exist.
+    /// @param key key to be searched for
+    /// @return value associated with the key
+    // NOLINTNEXTLINE(fuchsia-overloaded-operator)
+    [[nodiscard]] constexpr V operator[](const K& key) const noexcept
+    {
+        return data.value(search(key));
+    }
+
+    /// @brief Checks if element with given key exists.
+    /// @param key key to be searched for
+    /// @return boolean that denotes key's existence
+    [[nodiscard]] constexpr bool contains(const K& key) const noexcept
+    {
+        return search(key) != data.elements();
+    }
+
+    /// @brief Retrieves number of elements of the image.
+    /// @return total size of a container, 0 for an invalid view
+    [[nodiscard]] constexpr size_type size() const noexcept
+    {
+        return data.elements();
+    }
+
+    /// @brief Gives constant iterator to a beginning, needed for the C++11 for-each cycle or the std::for_each.
+    /// @return constant iterator to a beginning
+    [[nodiscard]] constexpr const_iterator begin() const noexcept
+    {
+        return cbegin();
+    }
+
+    /// @brief Gives constant iterator to a beginning, might be also called using std::cbegin(...).
+    /// @return constant iterator to a beginning
+    [[nodiscard]] constexpr const_iterator cbegin() const noexcept
+    {
+        return const_iterator{data, 0};
+    }
+
+    /// @brief Gives constant iterator to an end, needed for the C++11 for-each cycle or the std::for_each.
+    /// @return constant iterator to an end (past the last element)
+    [[nodiscard]] constexpr const_iterator end() const noexcept
+    {
+        return cend();
+    }
+
+    /// @brief Gives constant iterator to an end, might be also called using std::cend(...).
+    /// @return constant iterator to an end (past the last element)
+    [[nodiscard]] constexpr const_iterator cend() const noexcept
+    {
+        return const_iterator{data, data.elements()};
+    }
+
+    /// @brief Only an invalid view is empty; this might also be called using std::empty(...).
+    /// @return true for an invalid view
+    [[nodiscard]] constexpr bool empty() const noexcept
+    {
+        return !valid();
+    }
+
+private:
+    /// @private slot of the key as in the backend::perfect_hash, number of elements if not found
+    [[nodiscard]] constexpr size_type search(const K& key) const noexcept
+    {
+        const auto count = data.elements();
+
+        if (count == 0)
+        {
+            return 0;
+        }
+
+        const auto hash = Hash{}(key);
+        const auto slot = detail::perfect_hash_slot(hash, data.seed(detail::perfect_hash_bucket(hash, count)), count);
+
+        return slot < count && KeyEqual{}(data.key(slot), key) ? slot : count;
+    }
+
+    storage data;
+};
+}  // namespace burda::ct
+
+#endif // CONSTEXPR_HASH_MAP_HASH_MAP_VIEW_HPP
@@ -0,0 +1,387 @@
+#ifndef CONSTEXPR_HASH_MAP_HASH_MULTIMAP_HPP
+#define CONSTEXPR_HASH_MAP_HASH_MULTIMAP_HPP
+
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include <constexpr_hash_map/constexpr_hash_map.hpp>
+
+namespace burda::ct
+{
+/// @private implementation details, not part of the public interface
+namespace detail
+{
+/// @private deliberately not constexpr, so that reaching it in constant evaluation makes the compilation fail
+inline void number_of_distinct_keys_does_not_match() noexcept
+{
+}
+}  // namespace detail
+
+/// @brief Compile-time multimap, one key might be associated with several values (e.g. MIME type to its file extensions).
+///        Values of every key are grouped contiguously in the constructor (in the order in which they were passed),
+///        so all of them are given by a single lookup as a contiguous range.
+/// @brief Number of distinct keys is a template argument (the index of the backend is built over them),
+///        if it doesn't match the elements, it's a compile error (when the multimap is constant-initialized).
+/// @details Distinct keys are found in O(N * M) comparisons at compile time; lookups are those of the Backend over M keys.
+/// @tparam M number of distinct keys
+/// @tparam N total number of elements (values)
+/// @tparam K data type for keys
+/// @tparam V data type for values
+/// @tparam Hash constexpr and default constructible function object giving std::uint64_t hashes of keys, see ct::hash
+/// @tparam KeyEqual constexpr and default constructible function object comparing keys, see ct::equal_to
+/// @tparam Backend lookup strategy, one of the types from the burda::ct::backend namespace, by default backend::automatic
+template <std::size_t M, std::size_t N, typename K, typename V, typename Hash = hash<K>, typename KeyEqual = equal_to<K>, typename Backend = backend::automatic>
+class hash_multimap
+{
+public:
+    /// @see std::unordered_multimap<...>::key_type
+    using key_type = K;
+    /// @brief type of the values
+    using value_type = V;
+    /// @see std::unordered_multimap<...>::size_type
+    using size_type = decltype(N);
+    /// @brief structure in which elements are passed to the constructor
+    using data_type = std::array<std::pair<K, V>, N>;
+    /// @brief structure in which distinct keys are stored, in the order required by the Backend
+    using keys_type = std::array<K, M>;
+    /// @brief structure in which values are stored, grouped by keys
+    using values_type = std::array<V, N>;
+    /// @brief iterator to the values
+    using const_iterator = typename values_type::const_iterator;
+    /// @see std::unordered_multimap<...>::hasher
+    using hasher = Hash;
+    /// @see std::unordered_multimap<...>::key_equal
+    using key_equal = KeyEqual;
+    /// @brief lookup strategy
+    using backend_type = Backend;
+
+    /// @brief Contiguous range of values associated with one key.
+    class value_range
+    {
+    public:
+        /// @brief Empty range.
+        constexpr value_range() noexcept = default;
+
+        /// @brief Range of the values between the iterators.
+        /// @param first first value
+        /// @param last past the last value
+        constexpr value_range(const_iterator first, const_iterator last) noexcept
+        : first_value{first}, last_value{last}
+        {
+        }
+
+        /// @brief Gives iterator to the first value.
+        /// @return constant iterator to a beginning
+        [[nodiscard]] constexpr const_iterator begin() const noexcept
+        {
+            return first_value;
+        }
+
+        /// @brief Gives iterator past the last value.
+        /// @return constant iterator to an end
+        [[nodiscard]] constexpr const_iterator end() const noexcept
+        {
+            return last_value;
+        }
+
+        /// @brief Retrieves number of values.
+        /// @return number of values in the range
+        [[nodiscard]] constexpr size_type size() const noexcept
+        {
+            return static_cast<size_type>(std::distance(first_value, last_value));
+        }
+
+        /// @brief Checks whether the range is empty (the key doesn't exist).
+        /// @return true if there are no values
+        [[nodiscard]] constexpr bool empty() const noexcept
+        {
+            return first_value == last_value;
+        }
+
+        /// @brief Retrieves value at the position in the range, doesn't perform any bounds checking.
+        /// @param position position in the range
+        /// @return reference to constant to the value
+        // NOLINTNEXTLINE(fuchsia-overloaded-operator)
+        [[nodiscard]] constexpr const V& operator[](size_type position) const noexcept
+        {
+            return *std::next(first_value, static_cast<std::ptrdiff_t>(position));
+        }
+
+    private:
+        const_iterator first_value{};
+        const_iterator last_value{};
+    };
+
+    /// @brief Construction from all the elements passed directly, values of the same key keep their order.
+    /// @tparam E type of the first element, automatically deduced by the compiler
+    /// @tparam R variadic arguments automatically deduced by the compiler
+    /// @param first first std::pair<K, V>
+    /// @param elements rest of the std::pair<K, V> elements
+    template <typename E, typename... R, std::enable_if_t<std::is_constructible_v<std::pair<K, V>, E&&>, int> = 0>
+    explicit CONSTEXPR_HASH_MAP_BUILD hash_multimap(E&& first, R&&... elements) noexcept
+    : hash_multimap{data_type{std::forward<E>(first), std::forward<R>(elements)...}}
+    {
+        static_assert(N == 1 + sizeof...(elements), "Elements size doesn't match expected size of a hash-multimap");
+    }
+
+    /// @brief Construction from all the elements gathered in an array, e.g. computed by a constexpr function (see make_hash_map).
+    /// @param elements all N std::pair<K, V> elements
+    explicit CONSTEXPR_HASH_MAP_BUILD hash_multimap(const data_type& elements) noexcept
+    : hash_multimap{elements, group(elements)}
+    {
+        static_assert(M > 0, "M should be positive");
+        static_assert(M <= N, "There can't be more distinct keys than elements");
+    }
+
+    /// @brief Gives all the values associated with the key.
+    /// @param key key to be searched for
+    /// @return contiguous range of values in the order in which they were passed to the constructor, empty if the key doesn't exist
+    [[nodiscard]] constexpr value_range equal_range(const K& key) const noexcept
+    {
+        return range_of(index.find(distinct, key));
+    }
+
+    /// @brief Counts values associated with the key.
+    /// @param key key to be searched for
+    /// @return number of values, 0 if the key doesn't exist
+    [[nodiscard]] constexpr size_type count(const K& key) const noexcept
+    {
+        return equal_range(key).size();
+    }
+
+    /// @brief Checks if the key exists.
+    /// @param key key to be searched for
+    /// @return boolean that denotes key's existence
+    [[nodiscard]] constexpr bool contains(const K& key) const noexcept
+    {
+        return index.find(distinct, key) != M;
+    }
+
+    /// @brief Heterogeneous equal_range (see the hash_map::find(const Query&)).
+    /// @tparam Query type of the query, automatically deduced by the compiler
+    /// @param key query
+    /// @return contiguous range of values, empty if the key doesn't exist
+    template <typename Query, std::enable_if_t<detail::is_heterogeneous_v<Hash, KeyEqual, K, Query>, int> = 0>
+    [[nodiscard]] constexpr value_range equal_range(const Query& key) const noexcept
+    {
+        return range_of(index.find(distinct, key));
+    }
+
+    /// @brief Heterogeneous count (see the hash_map::find(const Query&)).
+    /// @tparam Query type of the query, automatically deduced by the compiler
+    /// @param key query
+    /// @return number of values, 0 if the key doesn't exist
+    template <typename Query, std::enable_if_t<detail::is_heterogeneous_v<Hash, KeyEqual, K, Query>, int> = 0>
+    [[nodiscard]] constexpr size_type count(const Query& key) const noexcept
+    {
+        return equal_range(key).size();
+    }
+
+    /// @brief Heterogeneous contains (see the hash_map::find(const Query&)).
+    /// @tparam Query type of the query, automatically deduced by the compiler
+    /// @param key query
+    /// @return boolean that denotes key's existence
+    template <typename Query, std::enable_if_t<detail::is_heterogeneous_v<Hash, KeyEqual, K, Query>, int> = 0>
+    [[nodiscard]] constexpr bool contains(const Query& key) const noexcept
+    {
+        return index.find(distinct, key) != M;
+    }
+
+    /// @brief Retrieves lookup strategy of the multimap, e.g. the one chosen by the backend::automatic.
+    /// @return backend_kind of the Backend, backend_kind::custom for backends defined outside of this library
+    [[nodiscard]] constexpr backend_kind backend() const noexcept
+    {
+        if constexpr (detail::has_kind<lookup_type>::value)
+        {
+            return index.kind();
+        }
+        else if constexpr (detail::has_static_kind<Backend>::value)
+        {
+            return Backend::kind;
+        }
+        else
+        {
+            return backend_kind::custom;
+        }
+    }
+
+    /// @brief Gives the distinct keys, e.g. to enumerate all the groups with the equal_range.
+    /// @return reference to constant to the keys in the order required by the Backend
+    [[nodiscard]] constexpr const keys_type& keys() const noexcept
+    {
+        return distinct.keys;
+    }
+
+    /// @brief Retrieves number of distinct keys.
+    /// @return M
+    [[nodiscard]] constexpr size_type key_count() const noexcept
+    {
+        return M;
+    }
+
+    /// @brief Retrieves number of elements (values), might also be called indirectly using the std::size(...).
+    /// @return N
+    [[nodiscard]] constexpr size_type size() const noexcept
+    {
+        return N;
+    }
+
+    /// @brief Hash-multimap cannot be empty; this might also be called using std::empty(...).
+    /// @return false -- cannot be empty
+    [[nodiscard]] constexpr bool empty() const noexcept
+    {
+        return false;
+    }
+
+private:
+    /// @private lookup structure of the backend, built over the distinct keys
+    using lookup_type = typename Backend::template index<M, K, Hash, KeyEqual>;
+
+    /// @private gives distinct keys to the backend
+    struct key_storage
+    {
+        /// @private distinct keys
+        keys_type keys;
+
+        /// @private key at position i
+        [[nodiscard]] constexpr const K& key(std::size_t i) const noexcept
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+            return keys[i];
+        }
+    };
+
+    /// @private distinct keys in the order of their first occurrence and the distinct key of every element
+    struct grouping
+    {
+        /// @private distinct keys
+        key_storage distinct;
+        /// @private groups[i] is the position of the key of the i-th element in the distinct keys
+        std::array<std::size_t, N> groups;
+    };
+
+    /// @private finds distinct keys; fails the constant evaluation if there aren't exactly M of them
+    [[nodiscard]] static constexpr grouping group(const data_type& elements) noexcept
+    {
+        grouping result{};
+        std::size_t found = 0;
+
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            std::size_t position = 0;
+
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+            while (position < found && !KeyEqual{}(result.distinct.keys[position], elements[i].first))
+            {
+                ++position;
+            }
+
+            if (position == found)
+            {
+                if (found == M)
+                {
+                    detail::number_of_distinct_keys_does_not_match();
+
+                    return result;
+                }
+
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+                result.distinct.keys[found++] = elements[i].first;
+            }
+
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+            result.groups[i] = position;
+        }
+
+        if (found != M)
+        {
+            detail::number_of_distinct_keys_does_not_match();
+        }
+
+        return result;
+    }
+
+    /// @private builds the index over the distinct keys
+    CONSTEXPR_HASH_MAP_BUILD hash_multimap(const data_type& elements, const grouping& grouped) noexcept
+    : hash_multimap{elements, grouped, lookup_type::build(grouped.distinct)}
+    {
+    }
+
+    /// @private stores keys in the order required by the backend and values grouped by them
+    CONSTEXPR_HASH_MAP_BUILD hash_multimap(const data_type& elements, const grouping& grouped, const detail::build_result<lookup_type, M>& built) noexcept
+    : index{built.index}, distinct{arrange_keys(grouped, built)}, offsets{}, values{}
+    {
+        std::array<std::size_t, M> slots{};
+        std::array<std::size_t, M + 1> bounds{};
+
+        for (std::size_t slot = 0; slot < M; ++slot)
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+            slots[built.order[slot]] = slot;
+        }
+
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+            ++bounds[slots[grouped.groups[i]] + 1];
+        }
+
+        for (std::size_t slot = 0; slot < M; ++slot)
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+            bounds[slot + 1] += bounds[slot];
+        }
+
+        for (std::size_t slot = 0; slot <= M; ++slot)
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+            offsets[slot] = static_cast<detail::position_t<N>>(bounds[slot]);
+        }
+
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+            values[bounds[slots[grouped.groups[i]]]++] = elements[i].second;
+        }
+    }
+
+    /// @private distinct keys in the order required by the backend
+    [[nodiscard]] static constexpr key_storage arrange_keys(const grouping& grouped, const detail::build_result<lookup_type, M>& built) noexcept
+    {
+        key_storage result{};
+
+        for (std::size_t slot = 0; slot < M; ++slot)
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+            result.keys[slot] = grouped.distinct.keys[built.order[slot]];
+        }
+
+        return result;
+    }
+
+    /// @private values of the key at the slot, empty range if the slot is M (key not found)
+    [[nodiscard]] constexpr value_range range_of(std::size_t slot) const noexcept
+    {
+        if (slot == M)
+        {
+            return {};
+        }
+
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+        return {std::next(values.cbegin(), static_cast<std::ptrdiff_t>(offsets[slot])),
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+                std::next(values.cbegin(), static_cast<std::ptrdiff_t>(offsets[slot + 1]))};
+    }
+
+    lookup_type index;
+    key_storage distinct;
+    /// @private values of the key at the slot i are values[offsets[i]] ... values[offsets[i + 1] - 1]
+    std::array<detail::position_t<N>, M + 1> offsets;
+    values_type values;
+};
+}  // namespace burda::ct
+
+#endif // CONSTEXPR_HASH_MAP_HASH_MULTIMAP_HPP
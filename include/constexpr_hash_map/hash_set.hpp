@@ -0,0 +1,229 @@
+#ifndef CONSTEXPR_HASH_MAP_HASH_SET_HPP
+#define CONSTEXPR_HASH_MAP_HASH_SET_HPP
+
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include <constexpr_hash_map/constexpr_hash_map.hpp>
+
+namespace burda::ct
+{
+/// @brief Compile-time hash-set (membership of keys), sibling of the ct::hash_map that stores only keys, no values;
+///        lookups are done by the same backends as in the hash_map (perfect hashing, fingerprints, dense table, ...).
+/// @brief Multiple same keys are a compile error, if the set is constant-initialized (e.g. "static constexpr").
+/// @details Keys are stored in an std::array in the order required by the Backend (in the order of slots for the backend::perfect_hash).
+/// @tparam N total number of keys
+/// @tparam K data type for keys
+/// @tparam Hash constexpr and default constructible function object giving std::uint64_t hashes of keys, see ct::hash
+/// @tparam KeyEqual constexpr and default constructible function object comparing keys, see ct::equal_to
+/// @tparam Backend lookup strategy, one of the types from the burda::ct::backend namespace, by default backend::automatic
+template <std::size_t N, typename K, typename Hash = hash<K>, typename KeyEqual = equal_to<K>, typename Backend = backend::automatic>
+class hash_set
+{
+public:
+    /// @see std::unordered_set<...>::key_type
+    using key_type = K;
+    /// @see std::unordered_set<...>::value_type
+    using value_type = K;
+    /// @see std::unordered_set<...>::size_type
+    using size_type = decltype(N);
+    /// @brief structure in which keys are passed to the constructor and stored
+    using data_type = std::array<K, N>;
+    /// @see std::array<...>::const_iterator
+    using const_iterator = typename data_type::const_iterator;
+    /// @see std::unordered_set<...>::hasher
+    using hasher = Hash;
+    /// @see std::unordered_set<...>::key_equal
+    using key_equal = KeyEqual;
+    /// @brief lookup strategy
+    using backend_type = Backend;
+
+    /// @brief Construction from all the keys passed directly.
+    /// @tparam E type of the first key, automatically deduced by the compiler
+    /// @tparam R variadic arguments automatically deduced by the compiler
+    /// @param first first key
+    /// @param keys rest of the keys
+    template <typename E, typename... R, std::enable_if_t<std::is_constructible_v<K, E&&>, int> = 0>
+    explicit CONSTEXPR_HASH_MAP_BUILD hash_set(E&& first, R&&... keys) noexcept
+    : hash_set{data_type{std::forward<E>(first), std::forward<R>(keys)...}}
+    {
+        static_assert(N == 1 + sizeof...(keys), "Keys size doesn't match expected size of a hash-set");
+    }
+
+    /// @brief Construction from all the keys gathered in an array, e.g. computed by a constexpr function (see make_hash_map).
+    /// @param keys all N keys
+    explicit CONSTEXPR_HASH_MAP_BUILD hash_set(const data_type& keys) noexcept
+    : hash_set{keys, lookup_type::build(storage{keys})}
+    {
+        static_assert(N > 0, "N should be positive");
+    }
+
+    /// @brief Searches set for a given key and returns iterator.
+    /// @param key key to be searched for
+    /// @return constant iterator to the key (cend, if not found)
+    [[nodiscard]] constexpr const_iterator find(const K& key) const noexcept
+    {
+        return std::next(cbegin(), static_cast<std::ptrdiff_t>(index.find(data, key)));
+    }
+
+    /// @brief Checks if given key exists.
+    /// @param key key to be searched for
+    /// @return boolean that denotes key's existence
+    [[nodiscard]] constexpr bool contains(const K& key) const noexcept
+    {
+        return search(key);
+    }
+
+    /// @brief Searches set for a key equal to the query of another type (heterogeneous lookup, see the hash_map::find(const Query&)).
+    /// @tparam Query type of the query, automatically deduced by the compiler
+    /// @param key query
+    /// @return constant iterator to the key (cend, if not found)
+    template <typename Query, std::enable_if_t<detail::is_heterogeneous_v<Hash, KeyEqual, K, Query>, int> = 0>
+    [[nodiscard]] constexpr const_iterator find(const Query& key) const noexcept
+    {
+        return std::next(cbegin(), static_cast<std::ptrdiff_t>(index.find(data, key)));
+    }
+
+    /// @brief Checks if a key equal to the query of another type exists (heterogeneous lookup, see the hash_map::find(const Query&)).
+    /// @tparam Query type of the query, automatically deduced by the compiler
+    /// @param key query
+    /// @return boolean that denotes key's existence
+    template <typename Query, std::enable_if_t<detail::is_heterogeneous_v<Hash, KeyEqual, K, Query>, int> = 0>
+    [[nodiscard]] constexpr bool contains(const Query& key) const noexcept
+    {
+        return search(key);
+    }
+
+    /// @brief Checks if key of the given characters exists (heterogeneous lookup), e.g. a slice of a buffer that is not null-terminated.
+    /// @param characters first of the searched characters
+    /// @param count number of the searched characters
+    /// @return boolean that denotes key's existence
+    [[nodiscard]] constexpr bool contains(const char* characters, size_type count) const noexcept
+    {
+        return contains(std::string_view{characters, count});
+    }
+
+    /// @brief Retrieves lookup strategy of the set, e.g. the one chosen by the backend::automatic.
+    /// @return backend_kind of the Backend, backend_kind::custom for backends defined outside of this library
+    [[nodiscard]] constexpr backend_kind backend() const noexcept
+    {
+        if constexpr (detail::has_kind<lookup_type>::value)
+        {
+            return index.kind();
+        }
+        else if constexpr (detail::has_static_kind<Backend>::value)
+        {
+            return Backend::kind;
+        }
+        else
+        {
+            return backend_kind::custom;
+        }
+    }
+
+    /// @brief Retrieves size of a hash-set, might also be called indirectly using the std::size(...).
+    /// @return total size of a container
+    [[nodiscard]] constexpr size_type size() const noexcept
+    {
+        return N;
+    }
+
+    /// @brief Gives constant iterator to a beginning, needed for the C++11 for-each cycle or the std::for_each.
+    /// @return constant iterator to a beginning
+    [[nodiscard]] constexpr const_iterator begin() const noexcept
+    {
+        return cbegin();
+    }
+
+    /// @brief Gives constant iterator to a beginning, might be also called using std::cbegin(...).
+    /// @return constant iterator to a beginning
+    [[nodiscard]] constexpr const_iterator cbegin() const noexcept
+    {
+        return data.keys.cbegin();
+    }
+
+    /// @brief Gives constant iterator to an end, needed for the C++11 for-each cycle or the std::for_each.
+    /// @return constant iterator to an end (past the last key)
+    [[nodiscard]] constexpr const_iterator end() const noexcept
+    {
+        return cend();
+    }
+
+    /// @brief Gives constant iterator to an end, might be also called using std::cend(...).
+    /// @return constant iterator to an end (past the last key)
+    [[nodiscard]] constexpr const_iterator cend() const noexcept
+    {
+        return data.keys.cend();
+    }
+
+    /// @brief Hash-set cannot be empty; this might also be called using std::empty(...).
+    /// @return false -- cannot be empty
+    [[nodiscard]] constexpr bool empty() const noexcept
+    {
+        return false;
+    }
+
+private:
+    /// @private lookup structure of the backend
+    using lookup_type = typename Backend::template index<N, K, Hash, KeyEqual>;
+
+    /// @private gives keys to the backend
+    struct storage
+    {
+        /// @private stored keys
+        data_type keys;
+
+        /// @private key at position i
+        [[nodiscard]] constexpr const K& key(std::size_t i) const noexcept
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+            return keys[i];
+        }
+    };
+
+    /// @private stores keys in the order required by the backend
+    CONSTEXPR_HASH_MAP_BUILD hash_set(const data_type& keys, const detail::build_result<lookup_type, N>& built) noexcept
+    : hash_set{keys, built, std::make_index_sequence<N>{}}
+    {
+    }
+
+    /// @private see the hash_set(const data_type&, const detail::build_result<lookup_type, N>&)
+    template <std::size_t... I>
+    CONSTEXPR_HASH_MAP_BUILD hash_set(const data_type& keys, const detail::build_result<lookup_type, N>& built, std::index_sequence<I...> /*positions*/) noexcept
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+    : index{built.index}, data{data_type{keys[built.order[I]]...}}
+    {
+    }
+
+    /// @private checks existence of the key (or of the one equal to the query)
+    template <typename Query>
+    [[nodiscard]] constexpr bool search(const Query& key) const noexcept
+    {
+        if constexpr (detail::has_contains<lookup_type, storage, Query>::value)
+        {
+            return index.contains(data, key);
+        }
+        else
+        {
+            return index.find(data, key) != N;
+        }
+    }
+
+    lookup_type index;
+    storage data;
+};
+
+/// @brief Deduces N and K from the keys passed to the constructor, e.g. hash_set{"a", "b"} is hash_set<2, const char*>.
+template <typename K, typename... R>
+hash_set(K, R...) -> hash_set<1 + sizeof...(R), K>;
+
+/// @brief Deduces N and K from the array passed to the constructor.
+template <std::size_t N, typename K>
+hash_set(std::array<K, N>) -> hash_set<N, K>;
+}  // namespace burda::ct
+
+#endif // CONSTEXPR_HASH_MAP_HASH_SET_HPP
@@ -0,0 +1,280 @@
+#ifndef CONSTEXPR_HASH_MAP_INSTRUMENTATION_HPP
+#define CONSTEXPR_HASH_MAP_INSTRUMENTATION_HPP
+
+#include <atomic>
+#include <cinttypes>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <string_view>
+#include <type_traits>
+
+#include <constexpr_hash_map/constexpr_hash_map.hpp>
+
+namespace burda::ct
+{
+/// @brief Numbers of runtime lookups of one table, see instrumentation::counting.
+/// @details Comparisons are those of keys by the KeyEqual (or the length-checked comparisons of "const char*" keys by the backend::linear);
+///          vector scans, dense tables and ordered backends (which compare by their Compare) don't compare by it, so they aren't counted.
+struct lookup_statistics
+{
+    /// @brief lookups by the find, at, operator[], contains and the batch lookups
+    std::uint64_t lookups = 0;
+    /// @brief lookups of keys that exist
+    std::uint64_t hits = 0;
+    /// @brief lookups of keys that don't exist
+    std::uint64_t misses = 0;
+    /// @brief comparisons of keys made by all the lookups
+    std::uint64_t comparisons = 0;
+};
+
+/// @private implementation details, not part of the public interface
+namespace detail
+{
+/// @private comparisons made by the lookup in progress on the calling thread
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+inline thread_local std::uint64_t pending_comparisons = 0;
+
+/// @private marks the counted_equal as transparent, if the KeyEqual is
+template <typename KeyEqual, typename = void>
+struct transparent_like
+{
+};
+
+/// @private marks the counted_equal as transparent, if the KeyEqual is
+template <typename KeyEqual>
+struct transparent_like<KeyEqual, std::void_t<typename KeyEqual::is_transparent>>
+{
+    /// @private heterogeneous lookup stays available
+    using is_transparent = typename KeyEqual::is_transparent;
+};
+
+/// @private KeyEqual that counts its runtime calls (not the ones in constant evaluation, e.g. when the index is built)
+template <typename KeyEqual>
+struct counted_equal : transparent_like<KeyEqual>
+{
+    /// @private backends take their fast paths by the KeyEqual given to the hash_map, see detail::uninstrumented_t
+    using uninstrumented_type = KeyEqual;
+
+    /// @private counts the comparison and compares by the KeyEqual
+    template <typename Lhs, typename Rhs>
+    // NOLINTNEXTLINE(fuchsia-overloaded-operator)
+    [[nodiscard]] constexpr bool operator()(const Lhs& lhs, const Rhs& rhs) const noexcept
+    {
+        count();
+
+        return KeyEqual{}(lhs, rhs);
+    }
+
+    /// @private counts a comparison, see detail::count_comparison
+    static constexpr void count() noexcept
+    {
+        if (!is_constant_evaluated())
+        {
+            ++pending_comparisons;
+        }
+    }
+};
+
+/// @private counters of one table written by one thread and read by any (hence atomic, but incremented without read-modify-write)
+struct statistics_counters
+{
+    std::atomic<std::uint64_t> lookups{0};
+    std::atomic<std::uint64_t> hits{0};
+    std::atomic<std::uint64_t> misses{0};
+    std::atomic<std::uint64_t> comparisons{0};
+
+    /// @private adds to the counter, only the owning thread writes it, so a relaxed load and store suffice (no locked instruction)
+    static void add(std::atomic<std::uint64_t>& counter, std::uint64_t delta) noexcept
+    {
+        counter.store(counter.load(std::memory_order_relaxed) + delta, std::memory_order_relaxed);
+    }
+
+    /// @private adds the counters to the statistics
+    void accumulate(lookup_statistics& statistics) const noexcept
+    {
+        statistics.lookups += lookups.load(std::memory_order_relaxed);
+        statistics.hits += hits.load(std::memory_order_relaxed);
+        statistics.misses += misses.load(std::memory_order_relaxed);
+        statistics.comparisons += comparisons.load(std::memory_order_relaxed);
+    }
+};
+
+struct statistics_thread;
+
+/// @private counters of one table (named by the Tag of the instrumentation::counting), all of its threads and the threads that ended
+struct statistics_table
+{
+    std::string_view name;
+    lookup_statistics ended{};
+    statistics_thread* threads = nullptr;
+    statistics_table* next = nullptr;
+};
+
+/// @private guards the list of tables and the lists of their threads
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+inline std::mutex statistics_mutex;
+/// @private first table, to which a lookup was counted
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+inline statistics_table* statistics_tables = nullptr;
+
+/// @private counters of the table written by the thread, linked to the table while the thread runs
+struct statistics_thread
+{
+    /// @private links the counters to the table (on the first lookup of the table by the thread)
+    explicit statistics_thread(statistics_table& owner) noexcept
+    : table{owner}
+    {
+        const std::lock_guard<std::mutex> lock{statistics_mutex};
+
+        next = table.threads;
+        table.threads = this;
+    }
+
+    /// @private unlinks the counters (when the thread ends), they're kept in the table
+    ~statistics_thread()
+    {
+        const std::lock_guard<std::mutex> lock{statistics_mutex};
+
+        counters.accumulate(table.ended);
+
+        for (auto** link = &table.threads; *link != nullptr; link = &(*link)->next)
+        {
+            if (*link == this)
+            {
+                *link = next;
+                break;
+            }
+        }
+    }
+
+    statistics_thread(const statistics_thread&) = delete;
+    statistics_thread(statistics_thread&&) = delete;
+    statistics_thread& operator=(const statistics_thread&) = delete;
+    statistics_thread& operator=(statistics_thread&&) = delete;
+
+    statistics_table& table;
+    statistics_counters counters;
+    statistics_thread* next = nullptr;
+};
+
+/// @private table named by the Tag, linked to the list of tables on the first lookup
+template <typename Tag>
+[[nodiscard]] statistics_table& table_of() noexcept
+{
+    static statistics_table& table = []() -> statistics_table& {
+        static statistics_table result{std::string_view{Tag::name}};
+        const std::lock_guard<std::mutex> lock{statistics_mutex};
+
+        result.next = statistics_tables;
+        statistics_tables = &result;
+
+        return result;
+    }();
+
+    return table;
+}
+
+/// @private counters of the table named by the Tag written by the calling thread
+template <typename Tag>
+[[nodiscard]] statistics_counters& thread_counters_of() noexcept
+{
+    thread_local statistics_thread counters{table_of<Tag>()};
+
+    return counters.counters;
+}
+
+/// @private sums counters of the table of all the threads, mutex has to be locked
+[[nodiscard]] inline lookup_statistics sum(const statistics_table& table) noexcept
+{
+    auto result = table.ended;
+
+    for (const auto* thread = table.threads; thread != nullptr; thread = thread->next)
+    {
+        thread->counters.accumulate(result);
+    }
+
+    return result;
+}
+}  // namespace detail
+
+namespace instrumentation
+{
+/// @brief Counts lookups, hits, misses and comparisons of keys (see lookup_statistics) of the tables named by the Tag.
+///        Every thread counts into its own thread-local counters, reading them (statistics() or dump_lookup_statistics(...)) sums all the threads;
+///        counters of the threads that ended are kept.
+/// @details A lookup costs an access to the thread-local counters and a few increments without locked instructions;
+///          the mutex is locked only on the first lookup of the table by a thread, when the thread ends and when counters are read.
+///          Maps of the same Tag share the counters.
+/// @tparam Tag type with the static "name" (convertible to the std::string_view) under which lookups are reported
+template <typename Tag>
+struct counting
+{
+    /// @private lookups are observed
+    static constexpr bool enabled = true;
+
+    /// @private backend gets the KeyEqual that counts its calls
+    template <typename KeyEqual>
+    using key_equal = detail::counted_equal<KeyEqual>;
+
+    /// @private called before every runtime lookup
+    static void start() noexcept
+    {
+        detail::pending_comparisons = 0;
+    }
+
+    /// @private called after every runtime lookup
+    static void record(bool found) noexcept
+    {
+        auto& counters = detail::thread_counters_of<Tag>();
+
+        detail::statistics_counters::add(counters.lookups, 1);
+        detail::statistics_counters::add(found ? counters.hits : counters.misses, 1);
+        detail::statistics_counters::add(counters.comparisons, detail::pending_comparisons);
+    }
+
+    /// @brief Sums the counters of all the threads, that performed lookups of the tables named by the Tag.
+    /// @return statistics of the lookups so far (all zero if there were none)
+    [[nodiscard]] static lookup_statistics statistics() noexcept
+    {
+        auto& table = detail::table_of<Tag>();
+        const std::lock_guard<std::mutex> lock{detail::statistics_mutex};
+
+        return detail::sum(table);
+    }
+};
+}  // namespace instrumentation
+
+/// @brief Calls the function with the name and the statistics (summed over all the threads) of every table with the instrumentation::counting,
+///        that was looked up; e.g. to export them to the monitoring.
+/// @tparam Function invocable with the std::string_view and the const lookup_statistics&, automatically deduced by the compiler
+/// @param function called for every table, while counters are locked (it must not look up instrumented tables for the first time)
+template <typename Function>
+void for_each_lookup_statistics(Function&& function)
+{
+    const std::lock_guard<std::mutex> lock{detail::statistics_mutex};
+
+    for (const auto* table = detail::statistics_tables; table != nullptr; table = table->next)
+    {
+        const auto statistics = detail::sum(*table);
+        function(table->name, statistics);
+    }
+}
+
+/// @brief Writes one line with the statistics per table with the instrumentation::counting (see for_each_lookup_statistics),
+///        e.g. "status_codes: lookups 1200, hits 1100, misses 100, comparisons 1250 (1.04 per lookup)".
+/// @param stream where the lines are written to
+// NOLINTNEXTLINE(fuchsia-default-arguments-declarations)
+inline void dump_lookup_statistics(std::FILE* stream = stderr) noexcept
+{
+    for_each_lookup_statistics([stream](std::string_view name, const lookup_statistics& statistics) {
+        const auto per_lookup = statistics.lookups > 0 ? static_cast<double>(statistics.comparisons) / static_cast<double>(statistics.lookups) : 0.0;
+
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg, hicpp-vararg)
+        std::fprintf(stream, "%.*s: lookups %" PRIu64 ", hits %" PRIu64 ", misses %" PRIu64 ", comparisons %" PRIu64 " (%.2f per lookup)\n",
+                     static_cast<int>(name.size()), name.data(), statistics.lookups, statistics.hits, statistics.misses, statistics.comparisons, per_lookup);
+    });
+}
+}  // namespace burda::ct
+
+#endif // CONSTEXPR_HASH_MAP_INSTRUMENTATION_HPP
@@ -0,0 +1,362 @@
+#ifndef CONSTEXPR_HASH_MAP_PREFIX_TREE_HPP
+#define CONSTEXPR_HASH_MAP_PREFIX_TREE_HPP
+
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include <constexpr_hash_map/constexpr_hash_map.hpp>
+
+namespace burda::ct
+{
+/// @private implementation details, not part of the public interface
+namespace detail
+{
+/// @private key at the position of the iteration of the map
+template <const auto& Map>
+[[nodiscard]] constexpr std::string_view key_at(std::size_t position) noexcept
+{
+    return std::next(Map.cbegin(), static_cast<std::ptrdiff_t>(position))->first;
+}
+
+/// @private positions of the keys of the map in the lexicographical order
+template <const auto& Map>
+[[nodiscard]] constexpr std::array<std::size_t, Map.size()> sort_lexicographically() noexcept
+{
+    std::array<std::size_t, Map.size()> result{};
+
+    for (std::size_t position = 0; position < result.size(); ++position)
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+        result[position] = position;
+    }
+
+    heap_sort(result, [](std::size_t lhs, std::size_t rhs) { return key_at<Map>(lhs) < key_at<Map>(rhs); });
+
+    return result;
+}
+
+/// @private number of distinct prefixes of the keys: the empty one and those that a sorted key doesn't share with the previous one
+template <const auto& Map>
+[[nodiscard]] constexpr std::size_t count_prefixes(const std::array<std::size_t, Map.size()>& sorted) noexcept
+{
+    std::size_t result = 1;
+    std::string_view previous;
+
+    for (const auto position : sorted)
+    {
+        const auto current = key_at<Map>(position);
+        std::size_t common = 0;
+
+        while (common < current.size() && common < previous.size() && current[common] == previous[common])
+        {
+            ++common;
+        }
+
+        result += current.size() - common;
+        previous = current;
+    }
+
+    return result;
+}
+
+/// @private flat arrays of the prefix tree of N keys, indexed by nodes numbered breadth-first (root is 0)
+template <std::size_t Nodes, std::size_t N>
+struct prefix_tables
+{
+    /// @private character on the edge from the parent
+    std::array<char, Nodes> labels{};
+    /// @private children of the node i are nodes children[i] ... children[i + 1] - 1
+    std::array<position_t<Nodes>, Nodes + 1> children{};
+    /// @private position (in the map) of the key ending in the node, N if there's none
+    std::array<position_t<N>, Nodes> terminals{};
+    /// @private keys with the prefix of the node i are order[first[i]] ... order[last[i] - 1]
+    std::array<position_t<N>, Nodes> first{};
+    /// @private see the first
+    std::array<position_t<N>, Nodes> last{};
+    /// @private positions (in the map) of the keys in the lexicographical order
+    std::array<position_t<N>, N> order{};
+};
+
+/// @private builds the prefix tree breadth-first: every node is split to children by the character that follows its prefix
+template <const auto& Map, std::size_t Nodes>
+[[nodiscard]] constexpr prefix_tables<Nodes, Map.size()> build_prefix_tree(const std::array<std::size_t, Map.size()>& sorted) noexcept
+{
+    using node_type = position_t<Nodes>;
+    using rank_type = position_t<Map.size()>;
+
+    prefix_tables<Nodes, Map.size()> result{};
+    std::array<std::size_t, Nodes> depths{};
+    std::size_t next = 1;
+
+    for (std::size_t rank = 0; rank < sorted.size(); ++rank)
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+        result.order[rank] = static_cast<rank_type>(sorted[rank]);
+    }
+
+    result.last[0] = static_cast<rank_type>(Map.size());
+
+    for (std::size_t node = 0; node < Nodes; ++node)
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+        const auto depth = depths[node];
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+        std::size_t begin = result.first[node];
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+        const std::size_t end = result.last[node];
+
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+        result.children[node] = static_cast<node_type>(next);
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+        result.terminals[node] = static_cast<rank_type>(Map.size());
+
+        // the only key equal to the prefix sorts first
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+        if (begin < end && key_at<Map>(sorted[begin]).size() == depth)
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+            result.terminals[node] = static_cast<rank_type>(sorted[begin]);
+            ++begin;
+        }
+
+        while (begin < end)
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+            const auto character = key_at<Map>(sorted[begin])[depth];
+            auto group = begin + 1;
+
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+            while (group < end && key_at<Map>(sorted[group])[depth] == character)
+            {
+                ++group;
+            }
+
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+            result.labels[next] = character;
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+            result.first[next] = static_cast<rank_type>(begin);
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+            result.last[next] = static_cast<rank_type>(group);
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+            depths[next] = depth + 1;
+            ++next;
+            begin = group;
+        }
+    }
+
+    result.children[Nodes] = static_cast<node_type>(next);
+
+    return result;
+}
+}  // namespace detail
+
+/// @brief Prefix tree (trie) over the string keys of the ct::hash_map built at compile time, answers the longest-prefix match
+///        (e.g. routing of "/api/v1/users/42" to "/api/v1/users") and queries for all the keys with given prefix.
+/// @details Tree is kept in flat constexpr arrays: nodes are numbered breadth-first, so children of every node are contiguous
+///          and a step down the tree is a scan over a few characters; every node also knows the range of keys (sorted lexicographically)
+///          below it. Characters are compared exactly (byte by byte), regardless of the KeyEqual of the Keys. Nothing is allocated.
+/// @tparam Keys constexpr ct::hash_map with the static storage duration and keys convertible to the std::string_view
+template <const auto& Keys>
+class prefix_tree
+{
+public:
+    /// @brief ct::hash_map that holds the keys
+    using key_set_type = std::decay_t<decltype(Keys)>;
+    /// @see std::unordered_map<...>::size_type
+    using size_type = typename key_set_type::size_type;
+    /// @brief iterator to the elements of the Keys
+    using const_iterator = typename key_set_type::const_iterator;
+
+    static_assert(std::is_convertible_v<typename key_set_type::key_type, std::string_view>, "Keys should be strings");
+
+    /// @brief Forward iterator over the elements of the Keys with the prefix given to the starts_with(...), in the lexicographical order of keys.
+    class const_match_iterator
+    {
+    public:
+        /// @see std::iterator_traits<...>::value_type
+        using value_type = typename std::iterator_traits<const_iterator>::value_type;
+        /// @see std::iterator_traits<...>::reference
+        using reference = typename std::iterator_traits<const_iterator>::reference;
+        /// @brief access to the members of the elements goes through the iterator of the Keys
+        using pointer = const_iterator;
+        /// @see std::iterator_traits<...>::difference_type
+        using difference_type = std::ptrdiff_t;
+        /// @see std::iterator_traits<...>::iterator_category
+        using iterator_category = std::forward_iterator_tag;
+
+        /// @brief Singular iterator.
+        constexpr const_match_iterator() noexcept = default;
+
+        /// @brief Element of the Keys.
+        /// @return what the const_iterator of the Keys gives
+        // NOLINTNEXTLINE(fuchsia-overloaded-operator)
+        [[nodiscard]] constexpr reference operator*() const noexcept
+        {
+            return *element();
+        }
+
+        /// @brief Access to the key and the value.
+        /// @return iterator of the Keys to the element
+        // NOLINTNEXTLINE(fuchsia-overloaded-operator)
+        [[nodiscard]] constexpr pointer operator->() const noexcept
+        {
+            return element();
+        }
+
+        /// @brief Moves to the next key with the prefix.
+        /// @return reference to this iterator
+        // NOLINTNEXTLINE(fuchsia-overloaded-operator)
+        constexpr const_match_iterator& operator++() noexcept
+        {
+            ++rank;
+
+            return *this;
+        }
+
+        /// @brief Moves to the next key with the prefix.
+        /// @return copy of this iterator before the move
+        // NOLINTNEXTLINE(fuchsia-overloaded-operator)
+        constexpr const_match_iterator operator++(int) noexcept
+        {
+            auto previous = *this;
+            ++rank;
+
+            return previous;
+        }
+
+        /// @brief Compares positions of the iterators.
+        /// @param other iterator to compare with
+        /// @return true if both point to the same key
+        // NOLINTNEXTLINE(fuchsia-overloaded-operator)
+        [[nodiscard]] constexpr bool operator==(const const_match_iterator& other) const noexcept
+        {
+            return rank == other.rank;
+        }
+
+        /// @brief Compares positions of the iterators.
+        /// @param other iterator to compare with
+        /// @return true if they point to different keys
+        // NOLINTNEXTLINE(fuchsia-overloaded-operator)
+        [[nodiscard]] constexpr bool operator!=(const const_match_iterator& other) const noexcept
+        {
+            return rank != other.rank;
+        }
+
+        /// @brief Iterator of the Keys to the same element, e.g. to compare it with the Keys.find(...).
+        /// @return iterator of the Keys
+        [[nodiscard]] constexpr const_iterator element() const noexcept
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+            return std::next(Keys.cbegin(), static_cast<std::ptrdiff_t>(tree.order[rank]));
+        }
+
+    private:
+        friend class prefix_tree;
+
+        /// @private iterator to the key with given position in the lexicographical order
+        explicit constexpr const_match_iterator(std::size_t position) noexcept
+        : rank{position}
+        {
+        }
+
+        std::size_t rank = 0;
+    };
+
+    /// @brief Finds the longest key that is a prefix of the text, as a single walk down the tree.
+    /// @param text text to be matched, e.g. a path
+    /// @return iterator to the element with the longest matching key, cend() of the Keys if no key is a prefix of the text
+    [[nodiscard]] static constexpr const_iterator longest_prefix(std::string_view text) noexcept
+    {
+        std::size_t node = 0;
+        std::size_t found = tree.terminals[0];
+
+        for (const auto character : text)
+        {
+            node = child(node, character);
+
+            if (node == 0)
+            {
+                break;
+            }
+
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+            found = tree.terminals[node] != Keys.size() ? tree.terminals[node] : found;
+        }
+
+        return std::next(Keys.cbegin(), static_cast<std::ptrdiff_t>(found));
+    }
+
+    /// @brief Finds all the keys that start with the prefix (the prefix itself included, if it's a key).
+    /// @param prefix prefix to be searched for, empty one matches all the keys
+    /// @return pair of iterators delimiting the elements with matching keys, in the lexicographical order of keys; empty if there are none
+    [[nodiscard]] static constexpr std::pair<const_match_iterator, const_match_iterator> starts_with(std::string_view prefix) noexcept
+    {
+        std::size_t node = 0;
+
+        for (const auto character : prefix)
+        {
+            node = child(node, character);
+
+            if (node == 0)
+            {
+                return {const_match_iterator{0}, const_match_iterator{0}};
+            }
+        }
+
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+        return {const_match_iterator{tree.first[node]}, const_match_iterator{tree.last[node]}};
+    }
+
+    /// @brief Checks if there's any key that starts with the prefix.
+    /// @param prefix prefix to be searched for
+    /// @return boolean that denotes existence of such key
+    [[nodiscard]] static constexpr bool has_prefix(std::string_view prefix) noexcept
+    {
+        const auto range = starts_with(prefix);
+
+        return range.first != range.second;
+    }
+
+    /// @brief Retrieves number of keys.
+    /// @return number of keys of the Keys
+    [[nodiscard]] static constexpr size_type size() noexcept
+    {
+        return Keys.size();
+    }
+
+    /// @brief Retrieves number of nodes of the tree (distinct prefixes of the keys, including the empty one).
+    /// @return number of nodes
+    [[nodiscard]] static constexpr std::size_t node_count() noexcept
+    {
+        return nodes;
+    }
+
+private:
+    static constexpr std::array<std::size_t, Keys.size()> sorted = detail::sort_lexicographically<Keys>();
+    static constexpr std::size_t nodes = detail::count_prefixes<Keys>(sorted);
+
+    /// @private child of the node along the character, 0 (the root is nobody's child) if there's none
+    [[nodiscard]] static constexpr std::size_t child(std::size_t node, char character) noexcept
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+        for (std::size_t candidate = tree.children[node]; candidate < tree.children[node + 1]; ++candidate)
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+            if (tree.labels[candidate] == character)
+            {
+                return candidate;
+            }
+        }
+
+        return 0;
+    }
+
+    static constexpr detail::prefix_tables<nodes, Keys.size()> tree = detail::build_prefix_tree<Keys, nodes>(sorted);
+};
+}  // namespace burda::ct
+
+#endif // CONSTEXPR_HASH_MAP_PREFIX_TREE_HPP
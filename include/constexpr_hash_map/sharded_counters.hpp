@@ -0,0 +1,165 @@
+#ifndef CONSTEXPR_HASH_MAP_SHARDED_COUNTERS_HPP
+#define CONSTEXPR_HASH_MAP_SHARDED_COUNTERS_HPP
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include <constexpr_hash_map/constexpr_hash_map.hpp>
+#include <constexpr_hash_map/static_key_map.hpp>
+
+namespace burda::ct
+{
+/// @brief Counters of the keys fixed at compile time by the ct::hash_map, meant to be incremented from many threads.
+///        Every thread increments counters of its own shard (threads are assigned to shards in turns), shards are aligned
+///        to cache lines, so increments from different threads don't contend for the same cache line; reading sums all the shards.
+/// @details Counters of one shard are contiguous, so the memory taken is Shards * N counters rounded up to the cache lines.
+///          If there are more threads than shards, threads share shards (increments are atomic, so still correct, just contended).
+/// @tparam Keys constexpr ct::hash_map with the static storage duration, gives keys and the index
+/// @tparam Shards number of shards, preferably not less than the number of threads incrementing the counters
+/// @tparam Counter integral type of counters
+template <const auto& Keys, std::size_t Shards = 16, typename Counter = std::uint64_t>
+class sharded_counters
+{
+public:
+    static_assert(Shards > 0, "Shards should be positive");
+    static_assert(std::is_integral_v<Counter>, "Counters should be integral");
+
+    /// @brief ct::hash_map that holds the keys
+    using key_set_type = std::decay_t<decltype(Keys)>;
+    /// @see std::unordered_map<...>::size_type
+    using size_type = typename key_set_type::size_type;
+    /// @brief sums of the counters of all the shards keyed by the Keys
+    using snapshot_type = static_key_map<Keys, Counter>;
+
+    /// @brief size of the cache line to which shards are aligned
+    static constexpr std::size_t cache_line_size = 64;
+
+    /// @brief Adds to the counter of the key in the shard of the calling thread (with relaxed memory ordering),
+    ///        keys that don't exist (e.g. coming from the runtime input) aren't counted.
+    /// @tparam Query key or query of another type (if the Keys support heterogeneous lookup), automatically deduced by the compiler
+    /// @param key key to be searched for
+    /// @param delta value to be added
+    /// @return true if the key exists (and was counted)
+    template <typename Query, std::enable_if_t<!std::is_invocable_v<Query>, int> = 0>
+    // NOLINTNEXTLINE(fuchsia-default-arguments-declarations)
+    bool increment(const Query& key, Counter delta = 1) noexcept
+    {
+        const auto position = detail::position_of<Keys>(key);
+
+        if (position == Keys.size())
+        {
+            return false;
+        }
+
+        add(position, delta);
+
+        return true;
+    }
+
+    /// @brief Adds to the counter of the key returned by the constexpr function, e.g. increment([] { return "key"; }),
+    ///        position of the key is found at compile time (fails to compile if the key doesn't exist).
+    /// @tparam KeyFunction constexpr function object without state, automatically deduced by the compiler
+    /// @param key returns the key
+    /// @param delta value to be added
+    template <typename KeyFunction, std::enable_if_t<std::is_invocable_v<KeyFunction>, int> = 0>
+    // NOLINTNEXTLINE(fuchsia-default-arguments-declarations)
+    void increment([[maybe_unused]] KeyFunction key, Counter delta = 1) noexcept
+    {
+        constexpr auto position = detail::position_of<Keys>(key());
+        static_assert(position != Keys.size(), "Key is not in the map");
+
+        add(position, delta);
+    }
+
+    /// @brief Sums the counter of the key over all the shards (with relaxed memory ordering).
+    /// @tparam Query key or query of another type (if the Keys support heterogeneous lookup), automatically deduced by the compiler
+    /// @param key key to be searched for
+    /// @return sum of the counters, 0 if the key doesn't exist
+    template <typename Query>
+    [[nodiscard]] Counter count(const Query& key) const noexcept
+    {
+        const auto position = detail::position_of<Keys>(key);
+
+        return position != Keys.size() ? sum(position) : Counter{};
+    }
+
+    /// @brief Sums the counters of all the keys over all the shards (with relaxed memory ordering);
+    ///        increments that happen concurrently might or might not be included.
+    /// @return map from the keys to their counts
+    [[nodiscard]] snapshot_type snapshot() const noexcept
+    {
+        snapshot_type result;
+
+        for (std::size_t position = 0; position < Keys.size(); ++position)
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+            result.values()[position] = sum(position);
+        }
+
+        return result;
+    }
+
+    /// @brief Sets all the counters to zero; increments that happen concurrently might or might not be preserved.
+    void reset() noexcept
+    {
+        for (auto& current : shards)
+        {
+            for (auto& counter : current.counters)
+            {
+                counter.store(Counter{}, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /// @brief Retrieves number of keys.
+    /// @return number of counters in every shard
+    [[nodiscard]] static constexpr size_type size() noexcept
+    {
+        return Keys.size();
+    }
+
+private:
+    /// @private counters of all the keys owned by some of the threads, aligned to cache lines (and padded to them)
+    struct alignas(cache_line_size) shard
+    {
+        std::array<std::atomic<Counter>, Keys.size()> counters{};
+    };
+
+    /// @private shard of the calling thread, threads are assigned in turns when they first increment any of the counters
+    [[nodiscard]] static std::size_t shard_of_thread() noexcept
+    {
+        static std::atomic<std::size_t> next{0};
+        thread_local const std::size_t index = next.fetch_add(1, std::memory_order_relaxed) % Shards;
+
+        return index;
+    }
+
+    /// @private adds to the counter at the position in the shard of the calling thread
+    void add(std::size_t position, Counter delta) noexcept
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+        shards[shard_of_thread()].counters[position].fetch_add(delta, std::memory_order_relaxed);
+    }
+
+    /// @private sum of the counters at the position over all the shards
+    [[nodiscard]] Counter sum(std::size_t position) const noexcept
+    {
+        Counter result{};
+
+        for (const auto& current : shards)
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+            result += current.counters[position].load(std::memory_order_relaxed);
+        }
+
+        return result;
+    }
+
+    std::array<shard, Shards> shards{};
+};
+}  // namespace burda::ct
+
+#endif // CONSTEXPR_HASH_MAP_SHARDED_COUNTERS_HPP
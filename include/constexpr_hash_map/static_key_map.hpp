@@ -0,0 +1,196 @@
+#ifndef CONSTEXPR_HASH_MAP_STATIC_KEY_MAP_HPP
+#define CONSTEXPR_HASH_MAP_STATIC_KEY_MAP_HPP
+
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include <constexpr_hash_map/constexpr_hash_map.hpp>
+
+namespace burda::ct
+{
+/// @brief Map with the set of keys fixed at compile time by the ct::hash_map and values that might be changed at runtime,
+///        e.g. per-key state or metrics without any heap allocation; lookups are those of the hash_map (O(1) with the backend::perfect_hash).
+/// @details Only values are stored in the object (in the order of the iteration of the Keys), keys and the index are shared
+///          by all the maps with the same Keys. Values might be std::atomic<...> to be updated concurrently from many threads.
+/// @tparam Keys constexpr ct::hash_map with the static storage duration, gives keys, index and the initial values
+/// @tparam V type of values, by default the same as in the Keys
+template <const auto& Keys, typename V = typename std::decay_t<decltype(Keys)>::value_type>
+class static_key_map
+{
+public:
+    /// @brief ct::hash_map that holds the keys
+    using key_set_type = std::decay_t<decltype(Keys)>;
+    /// @see std::unordered_map<...>::key_type
+    using key_type = typename key_set_type::key_type;
+    /// @brief type of the (mutable) values
+    using value_type = V;
+    /// @see std::unordered_map<...>::size_type
+    using size_type = typename key_set_type::size_type;
+    /// @brief structure in which values are stored, in the order of the iteration of the Keys
+    using data_type = std::array<V, Keys.size()>;
+
+    /// @brief Values are copies of the values of the Keys, if V is their type, value-initialized otherwise (e.g. counters start at zero).
+    constexpr static_key_map() noexcept
+    : static_key_map{std::make_index_sequence<Keys.size()>{}}
+    {
+    }
+
+    /// @brief Searches for a given key.
+    /// @tparam Query key or query of another type (if the Keys support heterogeneous lookup), automatically deduced by the compiler
+    /// @param key key to be searched for
+    /// @return pointer to the value, nullptr if not found
+    template <typename Query>
+    [[nodiscard]] constexpr V* find(const Query& key) noexcept
+    {
+        const auto position = detail::position_of<Keys>(key);
+
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+        return position != Keys.size() ? &slots[position] : nullptr;
+    }
+
+    /// @brief Searches for a given key.
+    /// @tparam Query key or query of another type (if the Keys support heterogeneous lookup), automatically deduced by the compiler
+    /// @param key key to be searched for
+    /// @return pointer to constant to the value, nullptr if not found
+    template <typename Query>
+    [[nodiscard]] constexpr const V* find(const Query& key) const noexcept
+    {
+        const auto position = detail::position_of<Keys>(key);
+
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+        return position != Keys.size() ? &slots[position] : nullptr;
+    }
+
+    /// @brief Retrieves reference to a value.
+    ///        Doesn't perform any bounds checking, behaviour is undefined if the key doesn't exist (see the get for keys known at compile time).
+    /// @tparam Query key or query of another type (if the Keys support heterogeneous lookup), automatically deduced by the compiler
+    /// @param key key to be searched for
+    /// @return reference to the value associated with the key
+    template <typename Query>
+    // NOLINTNEXTLINE(fuchsia-overloaded-operator)
+    [[nodiscard]] constexpr V& operator[](const Query& key) noexcept
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+        return slots[detail::position_of<Keys>(key)];
+    }
+
+    /// @brief Retrieves reference to constant to a value.
+    ///        Doesn't perform any bounds checking, behaviour is undefined if the key doesn't exist.
+    /// @tparam Query key or query of another type (if the Keys support heterogeneous lookup), automatically deduced by the compiler
+    /// @param key key to be searched for
+    /// @return reference to constant to the value associated with the key
+    template <typename Query>
+    // NOLINTNEXTLINE(fuchsia-overloaded-operator)
+    [[nodiscard]] constexpr const V& operator[](const Query& key) const noexcept
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+        return slots[detail::position_of<Keys>(key)];
+    }
+
+    /// @brief Checks if element with given key exists.
+    /// @tparam Query key or query of another type (if the Keys support heterogeneous lookup), automatically deduced by the compiler
+    /// @param key key to be searched for
+    /// @return boolean that denotes key's existence
+    template <typename Query>
+    [[nodiscard]] static constexpr bool contains(const Query& key) noexcept
+    {
+        return Keys.contains(key);
+    }
+
+    /// @brief Retrieves value of a key known at compile time, nothing but the access to the value is left in the runtime code.
+    ///        Fails to compile if the key doesn't exist.
+    /// @tparam Key integral or enumeration key, or pointer to a null-terminated array with the static storage duration (see ct::get)
+    /// @return reference to the value associated with the key
+    template <auto Key, std::enable_if_t<detail::is_key_argument_v<decltype(Key)>, int> = 0>
+    [[nodiscard]] constexpr V& get() noexcept
+    {
+        return slots[checked_position<detail::position_of<Keys>(Key)>()];
+    }
+
+#if defined(CONSTEXPR_HASH_MAP_CLASS_TEMPLATE_ARGUMENTS)
+    /// @brief Retrieves value of a key given by the string literal, e.g. get<"key">() (C++20), see the get<Key>().
+    /// @tparam Key string literal
+    /// @return reference to the value associated with the key
+    template <fixed_string Key>
+    [[nodiscard]] constexpr V& get() noexcept
+    {
+        return slots[checked_position<detail::position_of<Keys>(Key.characters.data())>()];
+    }
+#endif
+
+    /// @brief Retrieves value of a key returned by the constexpr function, e.g. get([] { return "key"; }), see the get<Key>().
+    /// @tparam KeyFunction constexpr function object without state, automatically deduced by the compiler
+    /// @param key returns the key
+    /// @return reference to the value associated with the key
+    template <typename KeyFunction>
+    [[nodiscard]] constexpr V& get([[maybe_unused]] KeyFunction key) noexcept
+    {
+        return slots[checked_position<detail::position_of<Keys>(key())>()];
+    }
+
+    /// @brief Retrieves size of a map, might also be called indirectly using the std::size(...).
+    /// @return number of keys
+    [[nodiscard]] static constexpr size_type size() noexcept
+    {
+        return Keys.size();
+    }
+
+    /// @brief Gives the map that holds the keys, its iteration order is the order of the values().
+    /// @return reference to constant to the Keys
+    [[nodiscard]] static constexpr const key_set_type& keys() noexcept
+    {
+        return Keys;
+    }
+
+    /// @brief Gives all the values, e.g. to reset or to aggregate them.
+    /// @return reference to the values in the order of the iteration of keys()
+    [[nodiscard]] constexpr data_type& values() noexcept
+    {
+        return slots;
+    }
+
+    /// @brief Gives all the values.
+    /// @return reference to constant to the values in the order of the iteration of keys()
+    [[nodiscard]] constexpr const data_type& values() const noexcept
+    {
+        return slots;
+    }
+
+private:
+    /// @private initializes every value, see the initial_value
+    template <std::size_t... I>
+    explicit constexpr static_key_map(std::index_sequence<I...> /*positions*/) noexcept
+    : slots{initial_value(I)...}
+    {
+    }
+
+    /// @private initial value at given position
+    [[nodiscard]] static constexpr V initial_value([[maybe_unused]] std::size_t position) noexcept
+    {
+        if constexpr (std::is_same_v<V, typename key_set_type::value_type>)
+        {
+            return std::next(Keys.cbegin(), static_cast<std::ptrdiff_t>(position))->second;
+        }
+        else
+        {
+            return V{};
+        }
+    }
+
+    /// @private position computed at compile time, fails to compile if the key wasn't found
+    template <std::size_t Position>
+    [[nodiscard]] static constexpr std::size_t checked_position() noexcept
+    {
+        static_assert(Position != Keys.size(), "Key is not in the map");
+
+        return Position;
+    }
+
+    data_type slots;
+};
+}  // namespace burda::ct
+
+#endif // CONSTEXPR_HASH_MAP_STATIC_KEY_MAP_HPP
@@ -1,6 +1,16 @@
+#include <array>
+#include <cstdint>
 #include <string_view>
 
 #include <constexpr_hash_map/constexpr_hash_map.hpp>
+#include <constexpr_hash_map/enum_table.hpp>
+#include <constexpr_hash_map/hash_map_view.hpp>
+#include <constexpr_hash_map/hash_multimap.hpp>
+#include <constexpr_hash_map/hash_set.hpp>
+#include <constexpr_hash_map/instrumentation.hpp>
+#include <constexpr_hash_map/prefix_tree.hpp>
+#include <constexpr_hash_map/sharded_counters.hpp>
+#include <constexpr_hash_map/static_key_map.hpp>
 
 int example_simple() noexcept
 {
@@ -49,7 +59,574 @@ int example_advanced() noexcept
     return it->second.size();
 }
 
+int example_perfect_hash() noexcept
+{
+    // lookups are O(1) -- one hash, two table reads and a single key comparison
+    static constexpr burda::ct::hash_map<4, std::string_view, int, burda::ct::hash<std::string_view>, burda::ct::equal_to<std::string_view>, burda::ct::backend::perfect_hash> map
+    {
+        std::make_pair("Accept", 1),
+        std::make_pair("Content-Length", 2),
+        std::make_pair("Content-Type", 3),
+        std::make_pair("Host", 4)
+    };
+
+    static_assert(map.contains("Host"));
+    static_assert(map["Content-Type"] == 3);
+    static_assert(!map.contains("Connection"));
+
+    return map.at("Content-Length").second;
+}
+
+enum class opcode
+{
+    load,
+    store,
+    jump
+};
+
+/// @brief custom hash, only the constexpr operator() giving std::uint64_t is needed
+struct opcode_hash
+{
+    [[nodiscard]] constexpr std::uint64_t operator()(opcode code) const noexcept
+    {
+        return static_cast<std::uint64_t>(code) * 0x9E3779B97F4A7C15ULL;
+    }
+};
+
+int example_custom_hash() noexcept
+{
+    // matching of headers regardless of case
+    static constexpr burda::ct::hash_map<2, std::string_view, int, burda::ct::case_insensitive_hash, burda::ct::case_insensitive_equal_to, burda::ct::backend::perfect_hash> headers
+    {
+        std::make_pair("Content-Type", 1),
+        std::make_pair("Host", 2)
+    };
+
+    static_assert(headers["content-type"] == 1);
+    static_assert(headers.contains("HOST"));
+
+    static constexpr burda::ct::hash_map<3, opcode, std::string_view, opcode_hash, burda::ct::equal_to<opcode>, burda::ct::backend::perfect_hash> names
+    {
+        std::make_pair(opcode::load, "load"),
+        std::make_pair(opcode::store, "store"),
+        std::make_pair(opcode::jump, "jump")
+    };
+
+    static_assert(names[opcode::store] == "store");
+
+    return headers.at("host").second + static_cast<int>(names[opcode::jump].size());
+}
+
+int example_dense(const int runtime_code) noexcept
+{
+    // integral keys in a narrow range are looked up directly in a table, no comparisons of keys are needed
+    static constexpr burda::ct::hash_map<4, int, std::string_view> map
+    {
+        std::make_pair(200, "OK"),
+        std::make_pair(201, "Created"),
+        std::make_pair(204, "No Content"),
+        std::make_pair(206, "Partial Content")
+    };
+
+    static_assert(map.backend() == burda::ct::backend_kind::dense);
+    static_assert(map[204] == "No Content");
+    static_assert(!map.contains(202));
+
+    return map.contains(runtime_code) ? static_cast<int>(map[runtime_code].size()) : 0;
+}
+
+int example_prebuilt() noexcept
+{
+    // elements in the order of slots and seeds of the perfect hash as emitted by the tools/generate_hash_map.py,
+    // the constructor only checks that every key lies in its slot
+    using methods_type = burda::ct::hash_map<4, std::string_view, int, burda::ct::hash<std::string_view>, burda::ct::equal_to<std::string_view>,
+                                             burda::ct::backend::perfect_hash>;
+
+    static constexpr methods_type methods
+    {
+        burda::ct::prebuilt,
+        methods_type::data_type
+        {{
+            {"POST", 2},
+            {"PUT", 3},
+            {"GET", 1},
+            {"DELETE", 4}
+        }},
+        std::array<std::uint32_t, 4>
+        {{
+            0x00000000U, 0x00000000U, 0x00000001U, 0x00000002U
+        }}
+    };
+
+    static_assert(methods["DELETE"] == 4);
+    static_assert(!methods.contains("PATCH"));
+
+    return methods["GET"] - 1;
+}
+
+int example_automatic() noexcept
+{
+    // default backend chooses the lookup strategy from the number and type of keys and from the keys themselves
+    static constexpr burda::ct::hash_map<3, int, int> sparse
+    {
+        std::make_pair(7, 1),
+        std::make_pair(70000, 2),
+        std::make_pair(7000000, 3)
+    };
+
+    static constexpr burda::ct::hash_map<10, std::string_view, int> methods
+    {
+        std::make_pair("GET", 1),
+        std::make_pair("HEAD", 2),
+        std::make_pair("POST", 3),
+        std::make_pair("PUT", 4),
+        std::make_pair("DELETE", 5),
+        std::make_pair("CONNECT", 6),
+        std::make_pair("OPTIONS", 7),
+        std::make_pair("TRACE", 8),
+        std::make_pair("PATCH", 9),
+        std::make_pair("PROPFIND", 10)
+    };
+
+    static_assert(sparse.backend() == burda::ct::backend_kind::linear);
+    static_assert(methods.backend() == burda::ct::backend_kind::perfect_hash);
+    static_assert(sparse[70000] == 2 && methods["PATCH"] == 9);
+
+    return sparse[7] + methods["GET"];
+}
+
+int example_layout() noexcept
+{
+    // keys and values are in separate arrays, so lookups touch only the keys
+    static constexpr burda::ct::hash_map<2, std::string_view, std::string_view, burda::ct::hash<std::string_view>, burda::ct::equal_to<std::string_view>, burda::ct::backend::linear, burda::ct::layout::soa> map
+    {
+        std::make_pair("key1", "value1"),
+        std::make_pair("key2", "value2")
+    };
+
+    static_assert(map["key1"] == "value1");
+    static_assert(map.find("key2")->second == "value2");
+
+    int total = 0;
+
+    // iterators give pairs of references to the key and the value
+    for (const auto& [key, value] : map)
+    {
+        total += static_cast<int>(key.size() + value.size());
+    }
+
+    return total;
+}
+
+int example_string_pool() noexcept
+{
+    static constexpr std::array<std::pair<std::string_view, std::string_view>, 3> types
+    {{
+        {"html", "text/html"},
+        {"json", "application/json"},
+        {"png", "image/png"}
+    }};
+
+    // keys and values are copied to two contiguous arrays of characters, sizes are computed from the elements
+    using layout_type = burda::ct::layout::string_pool<burda::ct::layout::pooled_key_bytes(types), burda::ct::layout::pooled_value_bytes(types)>;
+
+    static constexpr burda::ct::hash_map<3, std::string_view, std::string_view, burda::ct::hash<std::string_view>, burda::ct::equal_to<std::string_view>, burda::ct::backend::perfect_hash, layout_type> map{types};
+
+    static_assert(map["json"] == "application/json");
+    static_assert(!map.contains("jpeg"));
+
+    return static_cast<int>(map["png"].size());
+}
+
+int example_sorted() noexcept
+{
+    // elements are sorted at compile time, lookup is a binary search
+    static constexpr burda::ct::hash_map<4, std::string_view, int, burda::ct::hash<std::string_view>, burda::ct::equal_to<std::string_view>, burda::ct::backend::sorted<>> versions
+    {
+        std::make_pair("1.1", 11),
+        std::make_pair("3.0", 30),
+        std::make_pair("2.0", 20),
+        std::make_pair("1.0", 10)
+    };
+
+    static_assert(versions["2.0"] == 20);
+    static_assert(!versions.contains("2.5"));
+    // iteration goes in the order of keys
+    static_assert(versions.begin()->first == "1.0");
+    static_assert(versions.lower_bound("2.5")->second == 30);
+    static_assert(versions.upper_bound("1.1")->second == 20);
+    static_assert(versions.upper_bound("3.0") == versions.cend());
+
+    constexpr auto range = versions.equal_range("1.1");
+    static_assert(std::distance(range.first, range.second) == 1);
+
+    // the same queries, but the search is done over keys laid out in the breadth-first order of a binary tree
+    static constexpr burda::ct::hash_map<4, int, int, burda::ct::hash<int>, burda::ct::equal_to<int>, burda::ct::backend::eytzinger<>> ports
+    {
+        std::make_pair(443, 1),
+        std::make_pair(80, 2),
+        std::make_pair(8080, 3),
+        std::make_pair(22, 4)
+    };
+
+    static_assert(ports[8080] == 3);
+    static_assert(ports.lower_bound(100)->first == 443);
+
+    return versions.upper_bound("2.0")->second / 10 + ports.lower_bound(1)->second;
+}
+
+int example_generated() noexcept
+{
+    using squares_type = burda::ct::hash_map<8, int, int>;
+
+    // elements computed at compile time instead of being written out
+    static constexpr auto squares = burda::ct::make_hash_map<squares_type>([](std::size_t i) { return std::make_pair(static_cast<int>(i), static_cast<int>(i * i)); });
+    static_assert(squares[7] == 49);
+
+    // N, K and V are deduced from the pairs
+    static constexpr burda::ct::hash_map names
+    {
+        std::make_pair(opcode::load, std::string_view{"load"}),
+        std::make_pair(opcode::store, std::string_view{"store"}),
+        std::make_pair(opcode::jump, std::string_view{"jump"})
+    };
+
+    static_assert(std::is_same_v<decltype(names)::key_type, opcode>);
+
+    // reverse map (from names to opcodes), also built at compile time
+    static constexpr auto opcodes = burda::ct::invert(names);
+    static_assert(opcodes["store"] == opcode::store);
+    static_assert(!opcodes.contains("call"));
+
+    return squares[2] + static_cast<int>(opcodes["jump"]);
+}
+
+int example_composition() noexcept
+{
+    static constexpr burda::ct::hash_map defaults
+    {
+        std::make_pair(std::string_view{"timeout"}, 30),
+        std::make_pair(std::string_view{"retries"}, 3),
+        std::make_pair(std::string_view{"port"}, 80)
+    };
+
+    static constexpr burda::ct::hash_map overrides
+    {
+        std::make_pair(std::string_view{"port"}, 8080),
+        std::make_pair(std::string_view{"tls"}, 1)
+    };
+
+    // layered table with the index built anew, values of the overrides win
+    static constexpr auto config = burda::ct::merge<defaults, overrides>();
+    static_assert(config.size() == 4);
+    static_assert(config["port"] == 8080 && config["timeout"] == 30);
+
+    static constexpr auto limits = burda::ct::filter<config>([](std::string_view key, int) { return key != "port"; });
+    static_assert(!limits.contains("port"));
+
+    static constexpr auto milliseconds = burda::ct::transform_values(limits, [](std::string_view, int value) { return value * 1000; });
+    static_assert(milliseconds["timeout"] == 30000);
+
+    return static_cast<int>(limits.size()) - 3;
+}
+
+int example_heterogeneous() noexcept
+{
+    static constexpr burda::ct::hash_map<3, const char*, int, burda::ct::hash<const char*>, burda::ct::equal_to<const char*>, burda::ct::backend::perfect_hash> methods
+    {
+        std::make_pair("GET", 1),
+        std::make_pair("POST", 2),
+        std::make_pair("PUT", 3)
+    };
+
+    // slices of a parsed buffer are looked up directly, without copying them to a null-terminated string
+    constexpr std::string_view request = "POST /index.html";
+    static_assert(methods[request.substr(0, 4)] == 2);
+    static_assert(methods.contains(request.data(), 4));
+    static_assert(!methods.contains(request.data(), 3));
+
+    return methods.find(request.data(), 4)->second;
+}
+
+int example_batch(const int argc) noexcept
+{
+    static constexpr burda::ct::hash_map<3, int, const char*, burda::ct::hash<int>, burda::ct::equal_to<int>, burda::ct::backend::perfect_hash> codes
+    {
+        std::make_pair(200, "OK"),
+        std::make_pair(404, "Not Found"),
+        std::make_pair(500, "Internal Server Error")
+    };
+
+    static_assert([]
+    {
+        constexpr std::array<int, 4> requests{404, 302, 200, 500};
+        std::array<bool, 4> found{};
+
+        codes.contains_many(requests.begin(), requests.end(), found.begin());
+
+        return found[0] && !found[1] && found[2] && found[3];
+    }());
+
+    // at runtime, groups of keys are prefetched before being looked up, so their cache misses overlap
+    const std::array<int, 2> requests{argc * 200, 404};
+    std::array<decltype(codes)::const_iterator, 2> results{};
+
+    codes.find_many(requests.begin(), requests.end(), results.begin());
+
+    return results[0] == codes.end() ? 0 : 1;
+}
+
+static constexpr burda::ct::hash_map<3, const char*, int> limits
+{
+    std::make_pair("connections", 128),
+    std::make_pair("requests", 1000),
+    std::make_pair("timeout", 30)
+};
+
+int example_batch_span([[maybe_unused]] const int argc) noexcept
+{
+#if defined(CONSTEXPR_HASH_MAP_SPAN)
+    static constexpr burda::ct::hash_map<3, std::string_view, int> methods
+    {
+        std::make_pair("GET", 1),
+        std::make_pair("POST", 2),
+        std::make_pair("PUT", 3)
+    };
+
+    // spans (C++20) give the written part of the results
+    static_assert([]
+    {
+        constexpr std::array<std::string_view, 3> tokens{"GET", "BREW", "PUT"};
+        std::array<bool, 3> known{};
+
+        const auto written = methods.contains_many(std::span{tokens}, std::span{known});
+
+        return written.size() == 3 && written[0] && !written[1] && written[2];
+    }());
+
+    const std::array<std::string_view, 2> tokens{argc > 1 ? "BREW" : "POST", "GET"};
+    std::array<decltype(methods)::const_iterator, 2> results{};
+
+    const auto found = methods.find_many(std::span{tokens}, std::span{results});
+
+    return found[0] != methods.end() && found[1] != methods.end() ? 0 : 1;
+#else
+    return 0;
+#endif
+}
+
+int example_get() noexcept
+{
+    // position of the key is found by the compiler, what remains is a load of the value (a key that's missing wouldn't compile)
+    static_assert(burda::ct::get<limits>([] { return "timeout"; }) == 30);
+
+#if defined(CONSTEXPR_HASH_MAP_CLASS_TEMPLATE_ARGUMENTS)
+    static_assert(burda::ct::get<limits, "requests">() == 1000);
+#endif
+
+    return burda::ct::get<limits>([] { return "connections"; }) / 64;
+}
+
+int example_static_key_map() noexcept
+{
+    // keys and the index are those of the constexpr map, values are mutable (and initially copied from it)
+    static burda::ct::static_key_map<limits> current;
+
+    current["timeout"] = 60;
+    ++current.get([] { return "connections"; });
+
+    return current["timeout"] + current.get([] { return "connections"; }) - 188;
+}
+
+int example_sharded_counters() noexcept
+{
+    // every thread increments its own cache-line aligned shard, the snapshot sums them
+    static burda::ct::sharded_counters<limits, 4> hits;
+
+    // NOLINTNEXTLINE(fuchsia-default-arguments-calls)
+    hits.increment("timeout");
+    hits.increment([] { return "requests"; }, 2);
+    // keys that aren't in the map are dropped
+    // NOLINTNEXTLINE(fuchsia-default-arguments-calls)
+    const bool unknown = hits.increment("retries");
+
+    const auto totals = hits.snapshot();
+
+    return static_cast<int>(totals["timeout"] + totals["requests"]) - 3 + static_cast<int>(unknown);
+}
+
+int example_prefix_tree(const int argc, const char** argv) noexcept
+{
+    // trie over the keys built at compile time: the longest key that prefixes the path, or all the keys with a prefix
+    static constexpr burda::ct::hash_map<4, std::string_view, int> routes
+    {
+        std::make_pair("/", 1),
+        std::make_pair("/api/v1", 2),
+        std::make_pair("/api/v1/users", 3),
+        std::make_pair("/api/v2", 4)
+    };
+
+    using routes_tree = burda::ct::prefix_tree<routes>;
+
+    static_assert(routes_tree::longest_prefix("/api/v1/users/42")->second == 3);
+    static_assert(routes_tree::longest_prefix("/static/index.html")->second == 1);
+    static_assert(routes_tree::longest_prefix("api") == routes.cend());
+
+    const auto [first, last] = routes_tree::starts_with("/api/v1");
+    const auto matches = static_cast<int>(std::distance(first, last));
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    const auto route = routes_tree::longest_prefix(argc > 1 ? argv[1] : "/");
+
+    return matches + (route != routes.cend() ? route->second : 1) - 3;
+}
+
+int example_hash_set(const int argc, const char** argv) noexcept
+{
+    // only keys are stored, lookups are the same as in the hash_map
+    static constexpr burda::ct::hash_set types{"text/html", "text/plain", "image/png", "image/jpeg", "application/json"};
+
+    static_assert(types.contains("image/png"));
+    static_assert(!types.contains("image/gif"));
+
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    return argc > 1 && types.contains(argv[1]) ? 1 : 0;
+}
+
+int example_hash_multimap() noexcept
+{
+    // values of every key are grouped contiguously, one lookup gives all of them
+    static constexpr burda::ct::hash_multimap<3, 6, std::string_view, std::string_view> extensions
+    {
+        std::make_pair("image/jpeg", "jpg"),
+        std::make_pair("text/html", "html"),
+        std::make_pair("image/jpeg", "jpeg"),
+        std::make_pair("text/plain", "txt"),
+        std::make_pair("text/html", "htm"),
+        std::make_pair("image/jpeg", "jpe")
+    };
+
+    static_assert(extensions.count("image/jpeg") == 3);
+    static_assert(extensions.equal_range("text/html")[1] == "htm");
+    static_assert(extensions.equal_range("image/png").empty());
+
+    std::size_t characters = 0;
+
+    for (const auto extension : extensions.equal_range("image/jpeg"))
+    {
+        characters += extension.size();
+    }
+
+    return static_cast<int>(characters) - 10;
+}
+
+enum class level : std::uint8_t
+{
+    debug,
+    info,
+    warning,
+    error,
+    warn = warning
+};
+
+// one list gives both directions
+static constexpr std::array<std::pair<level, std::string_view>, 5> level_names
+{{
+    {level::debug, "debug"},
+    {level::info, "info"},
+    {level::warning, "warning"},
+    {level::error, "error"},
+    {level::warn, "warn"}
+}};
+
+int example_enum_table(const int argc) noexcept
+{
+    using levels = burda::ct::enum_table<level_names>;
+
+    static_assert(levels::to_string(level::error) == "error");
+    static_assert(levels::to_string(level::warn) == "warning");
+    static_assert(levels::from_string("warn").second == level::warning);
+    static_assert(!levels::from_string("fatal").first);
+
+    return levels::to_string(static_cast<level>(argc)) == "info" ? 0 : 1;
+}
+
+int example_view() noexcept
+{
+    using namespace std::string_view_literals;
+
+    // image written by the tools/generate_hash_map.py --format image --key-type int --value-type int, usually mapped from a file
+    static constexpr auto image =
+        "CTHM" "\1\0\0\0" "\40\0\0\0" "\40\0\0\0" "\0\0\0\0" "\3\0\0\0" "\140\0\0\0\0\0\0\0"   // version, bits of keys and values, flags, N, size
+        "\0\0\0\0" "\10\0\0\0" "\0\0\0\0" "\0\0\0\0"                                               // seeds (and padding)
+        "\310\0\0\0\0\0\0\0" "\224\1\0\0\0\0\0\0" "\367\1\0\0\0\0\0\0"                               // keys 200, 404, 503
+        "\2\0\0\0\0\0\0\0" "\4\0\0\0\0\0\0\0" "\5\0\0\0\0\0\0\0"sv;                                 // values
+
+    // lookups read the image in place, nothing is copied
+    static constexpr burda::ct::hash_map_view<int, int> classes{image.data(), image.size()};
+
+    static_assert(classes.valid());
+    static_assert(classes[404] == 4);
+    static_assert(!classes.contains(500));
+    // missing image (e.g. a file that failed to be mapped) gives an empty view
+    static_assert(!burda::ct::hash_map_view<int, int>{nullptr, 0}.valid());
+
+    return classes[200] - 2;
+}
+
+// names the counters of the instrumented map
+struct methods_tag
+{
+    static constexpr std::string_view name = "methods";
+};
+
+int example_runtime_keys(const int argc) noexcept
+{
+    // the same keys looked up at runtime by every backend, the lookups are inlined (see tools/check_codegen.sh)
+    static constexpr std::array<std::pair<int, int>, 4> ports
+    {
+        std::make_pair(22, 1),
+        std::make_pair(80, 2),
+        std::make_pair(443, 3),
+        std::make_pair(8080, 4)
+    };
+
+    static constexpr burda::ct::hash_map<4, int, int, burda::ct::hash<int>, burda::ct::equal_to<int>, burda::ct::backend::linear> linear{ports};
+    static constexpr burda::ct::hash_map<4, int, int, burda::ct::hash<int>, burda::ct::equal_to<int>, burda::ct::backend::fingerprint> fingerprint{ports};
+    static constexpr burda::ct::hash_map<4, int, int, burda::ct::hash<int>, burda::ct::equal_to<int>, burda::ct::backend::perfect_hash> perfect_hash{ports};
+    static constexpr burda::ct::hash_map<4, int, int, burda::ct::hash<int>, burda::ct::equal_to<int>, burda::ct::backend::sorted<>> sorted{ports};
+    static constexpr burda::ct::hash_map<4, int, int, burda::ct::hash<int>, burda::ct::equal_to<int>, burda::ct::backend::eytzinger<>> eytzinger{ports};
+
+    const auto port = argc * 80;
+
+    return static_cast<int>(linear.contains(port)) + static_cast<int>(fingerprint.contains(port)) + static_cast<int>(perfect_hash.contains(port))
+         + static_cast<int>(sorted.contains(port)) + static_cast<int>(eytzinger.contains(port)) - 5;
+}
+
+int example_instrumentation(const int argc, const char** argv) noexcept
+{
+    // runtime lookups are counted per thread, constexpr ones aren't
+    static constexpr burda::ct::hash_map<3, std::string_view, int, burda::ct::hash<std::string_view>, burda::ct::equal_to<std::string_view>,
+                                         burda::ct::backend::automatic, burda::ct::layout::aos, burda::ct::instrumentation::counting<methods_tag>> methods
+    {
+        std::make_pair("GET", 1),
+        std::make_pair("PUT", 2),
+        std::make_pair("POST", 3)
+    };
+
+    static_assert(methods["POST"] == 3);
+
+    for (int i = 1; i < argc; ++i)
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        static_cast<void>(methods.contains(argv[i]));
+    }
+
+    const auto statistics = burda::ct::instrumentation::counting<methods_tag>::statistics();
+
+    return static_cast<int>(statistics.hits + statistics.misses - statistics.lookups);
+}
+
 int main([[maybe_unused]] const int argc, [[maybe_unused]] const char** argv)
 {
-    return example_simple() + example_advanced();
+    return example_simple() + example_advanced() + example_perfect_hash() + example_custom_hash() + example_dense(argc) + example_prebuilt() + example_automatic() + example_layout() + example_sorted() + example_generated() + example_composition() + example_string_pool() + example_heterogeneous() + example_batch(argc) + example_batch_span(argc) + example_get() + example_static_key_map() + example_sharded_counters() + example_prefix_tree(argc, argv) + example_hash_set(argc, argv) + example_hash_multimap() + example_view() + example_enum_table(argc) + example_runtime_keys(argc) + example_instrumentation(argc, argv);
 }
@@ -0,0 +1,94 @@
+#!/usr/bin/env bash
+# Checks the x86-64 assembly generated for the examples of the main.cpp:
+# lookups of literal keys are folded to constants and lookups of runtime keys are inlined (no calls).
+#
+# Usage: tools/check_codegen.sh [compiler] [flags...], e.g. tools/check_codegen.sh clang++ -std=c++20
+
+set -euo pipefail
+
+compiler="${1:-g++}"
+shift || true
+
+root="$(cd "$(dirname "${BASH_SOURCE[0]}")/.." && pwd)"
+assembly="$(mktemp)"
+trap 'rm -f "${assembly}"' EXIT
+
+"${compiler}" "${root}/main.cpp" -I "${root}/include" -std=c++17 -O2 -S -o "${assembly}" -masm=att -fno-asynchronous-unwind-tables -fcf-protection=none "$@"
+
+failures=0
+
+# instructions of the function (of the main.cpp, in the global namespace), one per line
+instructions()
+{
+    awk -v prefix="_Z${#1}$1" '
+        index($0, prefix) == 1 && /:$/ { inside = 1; next }
+        inside && /^\t\.size/ { exit }
+        inside && /^\t[a-z]/ { sub(/^\t/, ""); gsub(/\t/, " "); sub(/ *#.*$/, ""); print }
+    ' "${assembly}"
+}
+
+# function returns the value without any other work
+constant()
+{
+    local body expected
+    body="$(instructions "$1" | tr '\n' ';')"
+    expected="movl \$$2, %eax;"
+
+    if [[ "$2" -eq 0 ]]
+    then
+        expected="xorl %eax, %eax;"
+    fi
+
+    if [[ "${body}" != "${expected}ret;" && "${body}" != "${expected}retq;" ]]
+    then
+        echo "$1: expected to return the constant $2, got: ${body:-nothing}"
+        failures=$((failures + 1))
+    fi
+}
+
+# function doesn't call (or tail-call) anything
+no_calls()
+{
+    local body calls
+    body="$(instructions "$1")"
+    calls="$(grep -E '^(call|jmp)[a-z]* +[^.*%]' <<< "${body}" || true)"
+
+    if [[ -z "${body}" ]]
+    then
+        echo "$1: not found"
+        failures=$((failures + 1))
+    elif [[ -n "${calls}" ]]
+    then
+        echo "$1: expected no calls, got:" ${calls}
+        failures=$((failures + 1))
+    fi
+}
+
+# literal keys
+constant example_simple 2
+constant example_advanced 6
+constant example_prebuilt 0
+constant example_automatic 2
+constant example_layout 20
+constant example_string_pool 9
+constant example_composition 0
+constant example_get 2
+constant example_hash_multimap 0
+constant example_view 0
+
+# runtime keys (and literal keys, that aren't folded), each backend
+no_calls example_perfect_hash
+no_calls example_custom_hash
+no_calls example_dense
+no_calls example_generated
+no_calls example_batch
+no_calls example_enum_table
+no_calls example_runtime_keys
+
+if [[ "${failures}" -ne 0 ]]
+then
+    echo "${failures} check(s) of the generated assembly failed (${compiler})"
+    exit 1
+fi
+
+echo "generated assembly is as expected (${compiler})"
@@ -0,0 +1,343 @@
+#!/usr/bin/env python3
+"""Generates a header with a constexpr burda::ct::hash_map from a CSV or JSON file, with the perfect hash computed ahead of time.
+
+Tables of thousands of elements are expensive to compile as variadic std::make_pair(...) arguments, and building
+their backend::perfect_hash in constexpr is expensive too. The generated header holds flat arrays instead: elements
+already in the order of their slots and seeds of the buckets, passed to the hash_map(burda::ct::prebuilt, ...) constructor,
+which only checks (in O(N)) that every key lies in its slot. Hashing and seeds are the same as those of the backend::perfect_hash.
+
+Input is either a CSV file with a header row (columns are chosen by --key-column and --value-column, the first two by default),
+a JSON object (keys to values), or a JSON array of [key, value] pairs or of objects (members chosen the same as CSV columns).
+Values of string types are quoted, others are emitted verbatim as C++ expressions (e.g. numbers or enumerators).
+
+With --format image, a binary image for the burda::ct::hash_map_view is written instead of the header, for tables too big
+for the compiler (hundreds of thousands of elements): the same seeds and elements in the order of slots, addressed by offsets,
+so that the image can be mapped to memory and looked up in place. Keys and values have to be strings or integers then.
+
+Usage: tools/generate_hash_map.py --input mime_types.csv --output mime_types.hpp --name mime_types
+                                  [--key-type std::string_view] [--value-type int] [--namespace generated] [--case-insensitive]
+       tools/generate_hash_map.py --input geo_codes.csv --output geo_codes.bin --format image [--key-type std::string_view] [--value-type std::uint32_t]
+"""
+
+import argparse
+import csv
+import json
+import pathlib
+import re
+import struct
+import sys
+
+MASK = (1 << 64) - 1
+GOLDEN_RATIO = 0x9E3779B97F4A7C15
+FNV_OFFSET_BASIS = 14695981039346656037
+FNV_PRIME = 1099511628211
+DIRECT_FLAG = 1 << 31
+IMAGE_MAGIC = b"CTHM"
+IMAGE_VERSION = 1
+IMAGE_HEADER_SIZE = 32
+IMAGE_CASE_INSENSITIVE = 1
+
+STRING_TYPES = ("const char*", "std::string_view")
+# bits of the integral key types (long is assumed to be 64 bits, as on LP64 platforms)
+INTEGRAL_TYPES = {
+    "char": 8, "signed char": 8, "unsigned char": 8, "std::int8_t": 8, "std::uint8_t": 8,
+    "short": 16, "unsigned short": 16, "std::int16_t": 16, "std::uint16_t": 16,
+    "int": 32, "unsigned": 32, "unsigned int": 32, "std::int32_t": 32, "std::uint32_t": 32,
+    "long": 64, "unsigned long": 64, "long long": 64, "unsigned long long": 64,
+    "std::int64_t": 64, "std::uint64_t": 64, "std::size_t": 64,
+}
+
+
+def mix(value):
+    """Finalizer of the splitmix64, same as the detail::mix."""
+    value = ((value ^ (value >> 30)) * 0xBF58476D1CE4E5B9) & MASK
+    value = ((value ^ (value >> 27)) * 0x94D049BB133111EB) & MASK
+
+    return value ^ (value >> 31)
+
+
+def fnv1a(data):
+    """64-bit FNV-1a of bytes, same as the detail::fnv1a."""
+    result = FNV_OFFSET_BASIS
+
+    for byte in data:
+        result = ((result ^ byte) * FNV_PRIME) & MASK
+
+    return result
+
+
+def lower(data):
+    """Lower-cases ASCII letters, same as the detail::to_lower."""
+    return bytes(byte + 32 if ord("A") <= byte <= ord("Z") else byte for byte in data)
+
+
+def hash_key(key, key_type, case_insensitive):
+    """Hash of the key as computed by the burda::ct::hash<K> (or the case_insensitive_hash)."""
+    if key_type in STRING_TYPES:
+        data = key.encode()
+
+        return fnv1a(lower(data) if case_insensitive else data)
+
+    bits = INTEGRAL_TYPES[key_type]
+
+    return mix(((key & ((1 << bits) - 1)) + GOLDEN_RATIO) & MASK)
+
+
+def displace(key_hash, seed, size):
+    """Slot of the hash within its bucket using given seed, same as the perfect_hash::index::displace."""
+    return mix(key_hash ^ ((seed * GOLDEN_RATIO) & MASK)) % size
+
+
+def build(hashes):
+    """Seeds of the buckets and the order of keys (order[slot] is the position of the key), as built by the backend::perfect_hash."""
+    size = len(hashes)
+    buckets = [[] for _ in range(size)]
+
+    for position, key_hash in enumerate(hashes):
+        buckets[key_hash % size].append(position)
+
+    seeds = [0] * size
+    order = [None] * size
+    taken = [False] * size
+
+    for bucket in sorted((bucket for bucket in range(size) if len(buckets[bucket]) > 1),
+                         key=lambda bucket: -len(buckets[bucket])):
+        members = buckets[bucket]
+
+        for seed in range(1, DIRECT_FLAG):
+            slots = [displace(hashes[member], seed, size) for member in members]
+
+            if len(set(slots)) == len(slots) and not any(taken[slot] for slot in slots):
+                break
+
+        for member, slot in zip(members, slots):
+            taken[slot] = True
+            order[slot] = member
+
+        seeds[bucket] = seed
+
+    free_slots = (slot for slot in range(size) if not taken[slot])
+
+    for bucket in range(size):
+        if len(buckets[bucket]) == 1:
+            slot = next(free_slots)
+            order[slot] = buckets[bucket][0]
+            seeds[bucket] = DIRECT_FLAG | slot
+
+    return seeds, order
+
+
+def read_elements(path, key_column, value_column):
+    """List of (key, value) pairs read from the CSV or JSON file, keys and values as strings or numbers."""
+    text = pathlib.Path(path).read_text(encoding="utf-8")
+
+    if pathlib.Path(path).suffix.lower() == ".json":
+        document = json.loads(text)
+
+        if isinstance(document, dict):
+            return list(document.items())
+
+        return [tuple(item) if isinstance(item, list) else pick(list(item.items()), key_column, value_column) for item in document]
+
+    rows = list(csv.reader(text.splitlines()))
+
+    return [pick(list(zip(rows[0], row)), key_column, value_column) for row in rows[1:] if row]
+
+
+def pick(fields, key_column, value_column):
+    """Key and value from the named fields, the first two if names aren't given."""
+    named = dict(fields)
+    key = named[key_column] if key_column else fields[0][1]
+    value = named[value_column] if value_column else fields[1][1]
+
+    return key, value
+
+
+def string_literal(text):
+    """C++ string literal with the UTF-8 bytes of the text, bytes that aren't printable ASCII are escaped in octal."""
+    escaped = []
+
+    for byte in text.encode():
+        character = chr(byte)
+
+        if character in "\"\\":
+            escaped.append("\\" + character)
+        elif 0x20 <= byte < 0x7F and character != "?":
+            escaped.append(character)
+        else:
+            escaped.append(f"\\{byte:03o}")
+
+    return '"' + "".join(escaped) + '"'
+
+
+def literal(value, type_name):
+    """Value as a C++ expression of the type."""
+    if type_name in STRING_TYPES:
+        return string_literal(str(value))
+
+    if isinstance(value, bool):
+        return "true" if value else "false"
+
+    return str(value)
+
+
+def convert_key(key, key_type):
+    if key_type in STRING_TYPES:
+        return str(key)
+
+    return int(str(key), 0)
+
+
+def build_table(arguments):
+    """Elements, seeds of the buckets and the order of elements in slots, checked for duplicate keys."""
+    if arguments.key_type not in STRING_TYPES and arguments.key_type not in INTEGRAL_TYPES:
+        raise SystemExit(f"unsupported key type {arguments.key_type}, supported are: {', '.join(STRING_TYPES + tuple(INTEGRAL_TYPES))}")
+
+    if arguments.case_insensitive and arguments.key_type != "std::string_view":
+        raise SystemExit("--case-insensitive needs std::string_view keys")
+
+    elements = [(convert_key(key, arguments.key_type), value) for key, value in read_elements(arguments.input, arguments.key_column, arguments.value_column)]
+
+    if not elements:
+        raise SystemExit("there are no elements")
+
+    hashes = [hash_key(key, arguments.key_type, arguments.case_insensitive) for key, _ in elements]
+    seen = {}
+
+    for position, key_hash in enumerate(hashes):
+        if key_hash in seen:
+            first = elements[seen[key_hash]][0]
+            problem = "duplicate keys" if first == elements[position][0] or arguments.case_insensitive else "different keys with the same hash"
+            raise SystemExit(f"{problem} aren't allowed: {first!r} and {elements[position][0]!r}")
+
+        seen[key_hash] = position
+
+    seeds, order = build(hashes)
+
+    return elements, seeds, order
+
+
+def generate(arguments):
+    """Header with the constexpr map constructed by the hash_map(burda::ct::prebuilt, ...) constructor."""
+    elements, seeds, order = build_table(arguments)
+
+    if arguments.case_insensitive:
+        hash_type, equal_type = "burda::ct::case_insensitive_hash", "burda::ct::case_insensitive_equal_to"
+    else:
+        hash_type, equal_type = f"burda::ct::hash<{arguments.key_type}>", f"burda::ct::equal_to<{arguments.key_type}>"
+
+    map_type = (f"burda::ct::hash_map<{len(elements)}, {arguments.key_type}, {arguments.value_type}, {hash_type}, {equal_type}, "
+                f"burda::ct::backend::perfect_hash>")
+    guard = re.sub(r"[^A-Z0-9]", "_", pathlib.Path(arguments.output).name.upper())
+    entries = ",\n".join(f"        {{{literal(elements[position][0], arguments.key_type)}, {literal(elements[position][1], arguments.value_type)}}}"
+                         for position in order)
+    seed_lines = ",\n".join("        " + ", ".join(f"0x{seed:08X}U" for seed in seeds[first:first + 8]) for first in range(0, len(seeds), 8))
+    includes = "".join(f"#include <{header}>\n" for header in ["array", "cstdint", "string_view"] + arguments.include)
+    opening, closing = (f"namespace {arguments.namespace}\n{{\n", f"}}  // namespace {arguments.namespace}\n") if arguments.namespace else ("", "")
+
+    return f"""// Generated by tools/generate_hash_map.py from {pathlib.Path(arguments.input).name}, don't edit.
+
+#ifndef {guard}
+#define {guard}
+
+{includes}
+#include <constexpr_hash_map/constexpr_hash_map.hpp>
+
+{opening}/// @brief type of the {arguments.name}
+using {arguments.name}_type = {map_type};
+
+/// @brief {len(elements)} elements in the order of their slots with the seeds of the perfect hash computed ahead of time
+inline constexpr {arguments.name}_type {arguments.name}
+{{
+    burda::ct::prebuilt,
+    {arguments.name}_type::data_type
+    {{{{
+{entries}
+    }}}},
+    std::array<std::uint32_t, {len(elements)}>
+    {{{{
+{seed_lines}
+    }}}}
+}};
+{closing}
+#endif // {guard}
+"""
+
+
+def image_bits(type_name, role):
+    """Bits with which keys or values of the type are stored in the image, 0 for strings."""
+    if type_name in STRING_TYPES:
+        return 0
+
+    if type_name not in INTEGRAL_TYPES:
+        raise SystemExit(f"{role} of images have to be strings or integers, not {type_name}")
+
+    return INTEGRAL_TYPES[type_name]
+
+
+def generate_image(arguments):
+    """Binary image for the burda::ct::hash_map_view, see its documentation for the layout."""
+    elements, seeds, order = build_table(arguments)
+    count = len(elements)
+    key_bits = image_bits(arguments.key_type, "keys")
+    value_bits = image_bits(arguments.value_type, "values")
+    keys_offset = IMAGE_HEADER_SIZE + (count * 4 + 7) // 8 * 8
+    characters_offset = keys_offset + count * 16
+    characters = bytearray()
+
+    def encode(item, bits):
+        if bits == 0:
+            data = str(item).encode()
+            offset = characters_offset + len(characters)
+            characters.extend(data)
+
+            return offset | (len(data) << 32)
+
+        return (item if isinstance(item, int) else int(str(item), 0)) & MASK
+
+    keys = [encode(elements[position][0], key_bits) for position in order]
+    values = [encode(elements[position][1], value_bits) for position in order]
+    size = (characters_offset + len(characters) + 7) // 8 * 8
+
+    if size > 0xFFFFFFFF:
+        raise SystemExit("images are addressed by 32-bit offsets, so they can't be bigger than 4 GiB")
+
+    flags = IMAGE_CASE_INSENSITIVE if arguments.case_insensitive else 0
+    header = struct.pack("<4sIIIIIQ", IMAGE_MAGIC, IMAGE_VERSION, key_bits, value_bits, flags, count, size)
+    seed_bytes = struct.pack(f"<{count}I", *seeds).ljust(keys_offset - IMAGE_HEADER_SIZE, b"\0")
+    tables = struct.pack(f"<{count}Q", *keys) + struct.pack(f"<{count}Q", *values)
+
+    return (header + seed_bytes + tables + bytes(characters)).ljust(size, b"\0")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--input", required=True, help="CSV or JSON (by the .json suffix) file with the elements")
+    parser.add_argument("--output", required=True, help="header to be written")
+    parser.add_argument("--name", help="name of the generated map (needed for the header)")
+    parser.add_argument("--key-type", default="std::string_view", help="const char*, std::string_view or an integral type")
+    parser.add_argument("--value-type", default="int", help="values of const char* and std::string_view are quoted, others are verbatim")
+    parser.add_argument("--key-column", help="CSV column (or JSON member) with keys, the first one by default")
+    parser.add_argument("--value-column", help="CSV column (or JSON member) with values, the second one by default")
+    parser.add_argument("--namespace", help="namespace of the generated map")
+    parser.add_argument("--include", action="append", default=[], help="additional header to be included, e.g. the one defining the value type")
+    parser.add_argument("--case-insensitive", action="store_true", help="keys compared by the case_insensitive_equal_to")
+    parser.add_argument("--format", choices=["header", "image"], default="header", help="C++ header or binary image for the hash_map_view")
+    arguments = parser.parse_args()
+
+    if arguments.format == "header" and not arguments.name:
+        parser.error("--name is needed for the header")
+
+    content = generate(arguments).encode("utf-8") if arguments.format == "header" else generate_image(arguments)
+    output = pathlib.Path(arguments.output)
+
+    # the output isn't rewritten if it didn't change, so that the build doesn't recompile what includes it
+    if not output.exists() or output.read_bytes() != content:
+        output.parent.mkdir(parents=True, exist_ok=True)
+        output.write_bytes(content)
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())